@@ -0,0 +1,329 @@
+#ifndef MSD_ZIP_MAPPED_COLUMN_HPP
+#define MSD_ZIP_MAPPED_COLUMN_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace msd {
+
+/**
+ * @brief How a `mapped_column` maps its file.
+ */
+enum class map_mode {
+    /**
+     * @brief The file is opened and mapped read-only. Elements can't be modified.
+     */
+    kReadOnly,
+
+    /**
+     * @brief The file is opened read-only. The mapping is private: elements can be modified in memory (the modified
+     * pages are copied), but the changes are never written to the file.
+     */
+    kCopyOnWrite,
+
+    /**
+     * @brief The file is opened for reading and writing. The mapping is shared: changes are written to the file.
+     */
+    kReadWrite,
+};
+
+/**
+ * @brief How a `mapped_column` is expected to be accessed, given to the kernel with `madvise`.
+ */
+enum class map_advice {
+    /**
+     * @brief No expectation.
+     */
+    kNormal,
+
+    /**
+     * @brief The elements are accessed in order, so pages are read ahead aggressively and can be freed soon after
+     * being accessed.
+     */
+    kSequential,
+
+    /**
+     * @brief The whole column is accessed soon, so reading it starts right away.
+     */
+    kWillNeed,
+};
+
+/**
+ * @brief A contiguous range over the elements of a binary file mapped into memory, usable as a zip column without
+ * loading the file.
+ *
+ * The file holds the raw bytes of the elements, in the representation of the machine. Pages are read by the kernel
+ * when accessed, so the memory used is bounded by the accessed pages, not by the file size.
+ *
+ * @code
+ * msd::zip zip(msd::mapped_column<std::int64_t>{"ts.bin"}, msd::mapped_column<double>{"px.bin"});
+ *
+ * msd::mapped_column<double, msd::map_mode::kReadWrite> prices{"px.bin"};
+ * @endcode
+ *
+ * @note Available on POSIX systems.
+ *
+ * @tparam T The type of the elements, which must be trivially copyable.
+ * @tparam Mode Whether the elements can be modified and whether changes are written to the file. Read-only columns
+ * give access to constant elements only.
+ */
+template <typename T, map_mode Mode = map_mode::kReadOnly>
+class mapped_column {
+    static_assert(std::is_trivially_copyable_v<T>, "mapped_column requires trivially copyable elements");
+
+   public:
+    /**
+     * @brief The type of the elements.
+     */
+    using value_type = T;
+
+    /**
+     * @brief Pointer to the elements, to constant elements for read-only columns.
+     */
+    using pointer = std::conditional_t<Mode == map_mode::kReadOnly, const T*, T*>;
+
+    /**
+     * @brief Reference to an element, to a constant element for read-only columns.
+     */
+    using reference = std::conditional_t<Mode == map_mode::kReadOnly, const T&, T&>;
+
+    /**
+     * @brief Iterator over the elements, over constant elements for read-only columns.
+     */
+    using iterator = pointer;
+
+    /**
+     * @brief Constant iterator over the elements.
+     */
+    using const_iterator = const T*;
+
+    /**
+     * @brief Maps a file.
+     *
+     * @param path The path of the file, whose size must be a multiple of the size of the elements.
+     * @param advice The expected access pattern.
+     * @throws std::system_error If the file can't be opened or mapped.
+     * @throws std::invalid_argument If the size of the file is not a multiple of the size of the elements.
+     */
+    explicit mapped_column(const std::string& path, const map_advice advice = map_advice::kSequential)
+    {
+        const int descriptor = ::open(path.c_str(), Mode == map_mode::kReadWrite ? O_RDWR : O_RDONLY);
+        if (descriptor < 0) {
+            throw std::system_error{errno, std::generic_category(), "cannot open " + path};
+        }
+
+        struct stat status {};
+        if (::fstat(descriptor, &status) != 0) {
+            const int error = errno;
+            ::close(descriptor);
+            throw std::system_error{error, std::generic_category(), "cannot stat " + path};
+        }
+
+        const auto bytes = static_cast<std::size_t>(status.st_size);
+        if (bytes % sizeof(T) != 0) {
+            ::close(descriptor);
+            throw std::invalid_argument{path + " does not hold a whole number of elements"};
+        }
+
+        // Empty files can't be mapped; they give empty columns.
+        if (bytes > 0) {
+            const int protection = Mode == map_mode::kReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+            const int flags = Mode == map_mode::kReadWrite ? MAP_SHARED : MAP_PRIVATE;
+            void* address = ::mmap(nullptr, bytes, protection, flags, descriptor, 0);
+            if (address == MAP_FAILED) {
+                const int error = errno;
+                ::close(descriptor);
+                throw std::system_error{error, std::generic_category(), "cannot map " + path};
+            }
+
+            data_ = static_cast<T*>(address);
+            size_ = bytes / sizeof(T);
+            advise(advice);
+        }
+
+        // The mapping keeps the file referenced.
+        ::close(descriptor);
+    }
+
+    /**
+     * @brief Moves the mapping of another column, which becomes empty.
+     *
+     * @param other The column to move from.
+     */
+    mapped_column(mapped_column&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)}
+    {
+    }
+
+    /**
+     * @brief Unmaps the file and moves the mapping of another column, which becomes empty.
+     *
+     * @param other The column to move from.
+     * @return A reference to this column.
+     */
+    mapped_column& operator=(mapped_column&& other) noexcept
+    {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    mapped_column(const mapped_column&) = delete;
+    mapped_column& operator=(const mapped_column&) = delete;
+
+    /**
+     * @brief Unmaps the file. Changes of read-write columns are written to the file by the kernel.
+     */
+    ~mapped_column() { unmap(); }
+
+    /**
+     * @brief Returns a pointer to the first element.
+     *
+     * @return A pointer to the elements, null if the column is empty.
+     */
+    pointer data() noexcept { return data_; }
+
+    /**
+     * @brief Returns a pointer to the first element.
+     *
+     * @return A pointer to the elements, null if the column is empty.
+     */
+    const T* data() const noexcept { return data_; }
+
+    /**
+     * @brief Returns an iterator to the first element.
+     *
+     * @return An iterator to the beginning of the column.
+     */
+    iterator begin() noexcept { return data_; }
+
+    /**
+     * @brief Returns an iterator to the first element.
+     *
+     * @return An iterator to the beginning of the column.
+     */
+    const_iterator begin() const noexcept { return data_; }
+
+    /**
+     * @brief Returns an iterator past the last element.
+     *
+     * @return An iterator to the end of the column.
+     */
+    iterator end() noexcept { return data_ + size_; }
+
+    /**
+     * @brief Returns an iterator past the last element.
+     *
+     * @return An iterator to the end of the column.
+     */
+    const_iterator end() const noexcept { return data_ + size_; }
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @return The number of elements in the file.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    /**
+     * @brief Checks if the column is empty.
+     *
+     * @return `true` if the file has no elements, `false` otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Returns an element.
+     *
+     * @param index The index of the element.
+     * @pre The index must be less than the size of the column.
+     * @return A reference to the element.
+     */
+    reference operator[](const std::size_t index) noexcept
+    {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    /**
+     * @brief Returns an element.
+     *
+     * @param index The index of the element.
+     * @pre The index must be less than the size of the column.
+     * @return A reference to the element.
+     */
+    const T& operator[](const std::size_t index) const noexcept
+    {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    /**
+     * @brief Changes the expected access pattern, e.g. before a new pass over the column.
+     *
+     * @param advice The expected access pattern.
+     */
+    void advise(const map_advice advice) const noexcept
+    {
+        if (data_ == nullptr) {
+            return;
+        }
+
+        int value = MADV_NORMAL;
+        if (advice == map_advice::kSequential) {
+            value = MADV_SEQUENTIAL;
+        }
+        else if (advice == map_advice::kWillNeed) {
+            value = MADV_WILLNEED;
+        }
+
+        // Advice is a hint; failing to give it doesn't affect the mapping.
+        static_cast<void>(::madvise(static_cast<void*>(data_), size_ * sizeof(T), value));
+    }
+
+    /**
+     * @brief Writes the changes of a read-write column to the file and waits for the write to complete.
+     *
+     * @throws std::system_error If the changes can't be written.
+     */
+    void flush() const
+    {
+        static_assert(Mode == map_mode::kReadWrite, "only read-write columns write their changes to the file");
+
+        if (data_ != nullptr && ::msync(static_cast<void*>(data_), size_ * sizeof(T), MS_SYNC) != 0) {
+            throw std::system_error{errno, std::generic_category(), "cannot write mapped column"};
+        }
+    }
+
+   private:
+    T* data_{nullptr};
+    std::size_t size_{0};
+
+    /**
+     * @brief Unmaps the file, if mapped.
+     */
+    void unmap() noexcept
+    {
+        if (data_ != nullptr) {
+            ::munmap(static_cast<void*>(data_), size_ * sizeof(T));
+        }
+    }
+};
+
+}  // namespace msd
+
+#endif  // MSD_ZIP_MAPPED_COLUMN_HPP
@@ -0,0 +1,330 @@
+#ifndef MSD_ZIP_UNZIP_HPP
+#define MSD_ZIP_UNZIP_HPP
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "zip.hpp"
+
+namespace msd {
+
+namespace detail {
+
+/**
+ * @brief The type of a row of a range (e.g. `zip_reference` for zips, `std::tuple&` for containers of tuples).
+ *
+ * @tparam Range The type of the range.
+ */
+template <typename Range>
+using row_reference_t = typename std::iterator_traits<iterator_t<std::remove_reference_t<Range>>>::reference;
+
+/**
+ * @brief The type of a row of a range, as stored (e.g. `std::tuple` of values for zips).
+ *
+ * @tparam Range The type of the range.
+ */
+template <typename Range>
+using row_value_t = typename std::iterator_traits<iterator_t<std::remove_reference_t<Range>>>::value_type;
+
+/**
+ * @brief The number of elements of each row of a range.
+ *
+ * @tparam Range The type of the range.
+ */
+template <typename Range>
+constexpr std::size_t kRowSize = std::tuple_size_v<std::remove_cv_t<std::remove_reference_t<row_reference_t<Range>>>>;
+
+/**
+ * @brief Checks if a range is a standard container, which owns its elements: a container with an allocator, or a
+ * `std::array`.
+ *
+ * @tparam Range The type of the range to be checked.
+ */
+template <typename Range, typename = void>
+class is_owning_container : public std::false_type {};
+
+/**
+ * @brief Checks if a range is a standard container, which owns its elements: a container with an allocator, or a
+ * `std::array`.
+ *
+ * @tparam Range The type of the range to be checked.
+ */
+template <typename Range>
+class is_owning_container<Range, std::void_t<typename Range::allocator_type>> : public std::true_type {};
+
+/**
+ * @brief A `std::array` owns its elements.
+ *
+ * @tparam T The type of the elements.
+ * @tparam N The number of elements.
+ */
+template <typename T, std::size_t N>
+class is_owning_container<std::array<T, N>> : public std::true_type {};
+
+/**
+ * @brief Checks if the elements of a column of a range are owned by the range, so they can be moved when the range is
+ * an rvalue.
+ *
+ * Only ranges known to own their elements qualify: standard containers of tuple-like rows, and zips owning the
+ * zipped container. Other ranges (e.g. `msd::iterator_range`, `msd::take_view`) may reference elements stored
+ * elsewhere, so their elements are copied.
+ *
+ * @tparam Range The type of the range, deduced from a forwarding reference (an lvalue reference for lvalues).
+ * @tparam I The index of the column.
+ */
+template <typename Range, std::size_t I>
+class owns_column : public std::bool_constant<!std::is_lvalue_reference_v<Range> &&
+                                              is_owning_container<std::remove_cv_t<Range>>::value &&
+                                              std::is_lvalue_reference_v<row_reference_t<Range>>> {};
+
+/**
+ * @brief Checks if the elements of a column of a zip are owned by the zip: an rvalue zip owns the standard containers
+ * which were moved into it. Views moved into it (e.g. `msd::iterator_range`) still reference elements stored elsewhere.
+ *
+ * @tparam I The index of the column.
+ * @tparam Containers The types of the zipped containers.
+ */
+template <std::size_t I, typename... Containers>
+class owns_column<zip<Containers...>, I>
+    : public std::bool_constant<
+          std::is_rvalue_reference_v<std::tuple_element_t<I, std::tuple<Containers...>>> &&
+          is_owning_container<
+              std::remove_cv_t<std::remove_reference_t<std::tuple_element_t<I, std::tuple<Containers...>>>>>::value> {};
+
+/**
+ * @brief Checks if the elements of a column of a range can be moved: they are owned by the range, or by rows returned
+ * by value.
+ *
+ * @tparam Range The type of the range, deduced from a forwarding reference.
+ * @tparam I The index of the column.
+ */
+template <typename Range, std::size_t I>
+constexpr bool kMovesColumn =
+    owns_column<Range, I>::value ||
+    (!std::is_lvalue_reference_v<row_reference_t<Range>> &&
+     !std::is_lvalue_reference_v<
+         std::tuple_element_t<I, std::remove_cv_t<std::remove_reference_t<row_reference_t<Range>>>>>);
+
+/**
+ * @brief Returns an element of a row, as an rvalue if it can be moved.
+ *
+ * @tparam Move Whether the element can be moved.
+ * @tparam I The index of the element.
+ * @tparam Row The type of the row.
+ * @param row The row.
+ * @return A reference to the element.
+ */
+template <bool Move, std::size_t I, typename Row>
+constexpr decltype(auto) row_element(Row& row)
+{
+    if constexpr (Move) {
+        return std::move(std::get<I>(row));
+    }
+    else {
+        return std::get<I>(row);
+    }
+}
+
+/**
+ * @brief Checks if a container can reserve memory for its elements.
+ *
+ * @tparam Container The type of the container to be checked.
+ */
+template <typename Container, typename = void>
+class has_reserve : public std::false_type {};
+
+/**
+ * @brief Checks if a container can reserve memory for its elements.
+ *
+ * @tparam Container The type of the container to be checked.
+ */
+template <typename Container>
+class has_reserve<Container, std::void_t<decltype(std::declval<Container&>().reserve(std::size_t{}))>>
+    : public std::true_type {};
+
+/**
+ * @brief Reserves memory for a number of elements to be appended to a container, if it supports it.
+ *
+ * @tparam Container The type of the container.
+ * @param container The container.
+ * @param count The number of elements to be appended.
+ */
+template <typename Container>
+void reserve_more(Container& container, const std::size_t count)
+{
+    if constexpr (has_reserve<Container>::value) {
+        container.reserve(container.size() + count);
+    }
+}
+
+/**
+ * @brief Reserves memory in the outputs if the size of the range is known, then appends the elements of each row to
+ * the outputs.
+ *
+ * @tparam Range The type of the range, deduced from a forwarding reference.
+ * @tparam I Indices of the columns.
+ * @tparam Outputs The types of the outputs.
+ * @param range The range.
+ * @param outputs The outputs, one for each column.
+ */
+template <typename Range, std::size_t... I, typename... Outputs>
+void unzip_into(std::remove_reference_t<Range>& range, std::index_sequence<I...>, Outputs&... outputs)
+{
+    if constexpr (has_size<std::remove_reference_t<Range>>::value) {
+        const auto size = container_size(range);
+        (reserve_more(outputs, size), ...);
+    }
+
+    for (auto&& row : range) {
+        (outputs.push_back(row_element<kMovesColumn<Range, I>, I>(row)), ...);
+    }
+}
+
+/**
+ * @brief The columns returned by `unzip`: a vector for each element of the rows.
+ *
+ * @tparam Row The type of the rows, as stored.
+ * @tparam I Indices of the elements of the rows.
+ */
+template <typename Row, typename = std::make_index_sequence<std::tuple_size_v<Row>>>
+class unzip_columns;
+
+/**
+ * @brief The columns returned by `unzip`: a vector for each element of the rows.
+ *
+ * @tparam Row The type of the rows, as stored.
+ * @tparam I Indices of the elements of the rows.
+ */
+template <typename Row, std::size_t... I>
+class unzip_columns<Row, std::index_sequence<I...>> {
+   public:
+    /**
+     * @brief A tuple of vectors of the elements.
+     */
+    using type = std::tuple<std::vector<std::remove_cv_t<std::tuple_element_t<I, Row>>>...>;
+};
+
+/**
+ * @brief The row type of `to_rows`: the given type, or the stored row type of the range.
+ *
+ * @tparam Row The given row type (`void` if not given).
+ * @tparam Range The type of the range.
+ */
+template <typename Row, typename Range>
+using to_rows_t = std::conditional_t<std::is_void_v<Row>, row_value_t<Range>, Row>;
+
+/**
+ * @brief Builds a row of the given type from the elements of each row of a range.
+ *
+ * @tparam Row The type of the built rows.
+ * @tparam Range The type of the range, deduced from a forwarding reference.
+ * @tparam I Indices of the columns.
+ * @param range The range.
+ * @return A vector of the built rows.
+ */
+template <typename Row, typename Range, std::size_t... I>
+std::vector<Row> to_rows(std::remove_reference_t<Range>& range, std::index_sequence<I...>)
+{
+    std::vector<Row> rows;
+    if constexpr (has_size<std::remove_reference_t<Range>>::value) {
+        rows.reserve(container_size(range));
+    }
+
+    for (auto&& row : range) {
+        rows.push_back(Row{row_element<kMovesColumn<Range, I>, I>(row)...});
+    }
+    return rows;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Appends the elements of each row of a range to a container for each column, in a single pass (array of
+ * structs to structure of arrays).
+ *
+ * The range can be a zip, a view or a container of tuple-like rows (`std::tuple`, `std::pair`, `std::array`). If its
+ * size is known without traversing it, memory for the appended elements is reserved in the outputs up front.
+ *
+ * Elements are moved instead of copied when they are owned by an rvalue range (a standard container of rows, or the
+ * containers moved into a zip) or by rows returned by value; elements of lvalue ranges, of views and of containers
+ * referenced by a zip are copied.
+ *
+ * @code
+ * std::vector<std::tuple<std::int64_t, double>> rows = read_rows();
+ * std::vector<std::int64_t> times;
+ * std::vector<double> prices;
+ * msd::unzip_into(std::move(rows), times, prices);
+ * @endcode
+ *
+ * @note If appending an element throws, the outputs keep the elements appended before.
+ *
+ * @tparam Range The type of the range.
+ * @tparam Outputs The types of the outputs, which must support `push_back`.
+ * @param range The range of rows.
+ * @param outputs The outputs, one for each element of the rows.
+ */
+template <typename Range, typename... Outputs>
+void unzip_into(Range&& range, Outputs&... outputs)
+{
+    static_assert(sizeof...(Outputs) == detail::kRowSize<Range>, "unzip_into requires an output for each column");
+
+    detail::unzip_into<Range>(range, std::index_sequence_for<Outputs...>{}, outputs...);
+}
+
+/**
+ * @brief Splits the rows of a range into a vector for each column, in a single pass (array of structs to structure of
+ * arrays).
+ *
+ * Memory is reserved and elements are moved as by `unzip_into`.
+ *
+ * @code
+ * auto [times, prices] = msd::unzip(std::move(rows));
+ * @endcode
+ *
+ * @tparam Range The type of the range.
+ * @param range The range of rows.
+ * @return A tuple of vectors of the elements of each column.
+ */
+template <typename Range>
+auto unzip(Range&& range)
+{
+    typename detail::unzip_columns<std::remove_cv_t<detail::row_value_t<Range>>>::type columns;
+    std::apply([&range](auto&... outputs) { unzip_into(std::forward<Range>(range), outputs...); }, columns);
+    return columns;
+}
+
+/**
+ * @brief Copies the rows of a range (e.g. a zip) into a vector of rows, in a single pass (structure of arrays to array
+ * of structs).
+ *
+ * Each row is built by brace initialization from the elements of a row of the range, so it can be a tuple or an
+ * aggregate with a member for each column. Memory is reserved and elements are moved as by `unzip_into`.
+ *
+ * @code
+ * struct quote {
+ *     std::int64_t time;
+ *     double price;
+ * };
+ * std::vector<quote> quotes = msd::to_rows<quote>(msd::zip(times, prices));
+ * @endcode
+ *
+ * @tparam Row The type of the rows, by default the value type of the range (a tuple of values for zips).
+ * @tparam Range The type of the range.
+ * @param range The range of rows.
+ * @return A vector of rows.
+ */
+template <typename Row = void, typename Range>
+std::vector<detail::to_rows_t<Row, Range>> to_rows(Range&& range)
+{
+    return detail::to_rows<detail::to_rows_t<Row, Range>, Range>(range,
+                                                                  std::make_index_sequence<detail::kRowSize<Range>>{});
+}
+
+}  // namespace msd
+
+#endif  // MSD_ZIP_UNZIP_HPP
@@ -2,9 +2,12 @@
 #define MSD_ZIP_ZIP_HPP
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
+#include <functional>
 #include <iterator>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -12,278 +15,2234 @@
 namespace msd {
 
 /**
- * @brief Bidirectional iterator over multiple iterators simultaneously.
+ * @brief The extent of a zip whose size is known only at runtime.
+ */
+inline constexpr std::size_t kDynamicExtent = static_cast<std::size_t>(-1);
+
+namespace detail {
+
+/**
+ * @brief Enables a member function only if the given iterator category is random access.
+ *
+ * @tparam Category The iterator category to be checked.
+ */
+template <typename Category>
+using enable_if_random_access_t =
+    std::enable_if_t<std::is_base_of_v<std::random_access_iterator_tag, Category>, int>;
+
+/**
+ * @brief The iterator type of a range (e.g. container, C array), based on whether the range is const or non-const.
+ *
+ * @tparam Container The type of the range.
+ */
+template <typename Container>
+using iterator_t = decltype(std::begin(std::declval<Container&>()));
+
+/**
+ * @brief Checks if the size of a container can be obtained with `std::size`.
+ *
+ * @tparam Container The type of the container to be checked.
+ */
+template <typename Container, typename = void>
+class has_size : public std::false_type {};
+
+/**
+ * @brief Checks if the size of a container can be obtained with `std::size`.
+ *
+ * @tparam Container The type of the container to be checked.
+ */
+template <typename Container>
+class has_size<Container, std::void_t<decltype(std::size(std::declval<const Container&>()))>>
+    : public std::true_type {};
+
+/**
+ * @brief Returns the number of elements in a container.
+ *
+ * Uses the size of the container if available (usually constant time), otherwise measures the distance between the
+ * beginning and the end of the container (e.g. `std::forward_list`).
+ *
+ * @tparam Container The type of the container.
+ * @param container The container to be measured.
+ * @return The number of elements in the container.
+ */
+template <typename Container>
+constexpr std::size_t container_size(const Container& container)
+{
+    if constexpr (has_size<Container>::value) {
+        return static_cast<std::size_t>(std::size(container));
+    }
+    else {
+        return static_cast<std::size_t>(std::distance(std::begin(container), std::end(container)));
+    }
+}
+
+/**
+ * @brief Checks if a container stores its elements contiguously.
+ *
+ * A container is considered contiguous if it has random access iterators and exposes its elements with `std::data`
+ * (e.g. `std::vector`, `std::array`, `std::string`, C arrays).
+ *
+ * @tparam Container The type of the container to be checked.
+ */
+template <typename Container, typename = void>
+class is_contiguous : public std::false_type {};
+
+/**
+ * @brief Checks if a container stores its elements contiguously.
+ *
+ * @tparam Container The type of the container to be checked.
+ */
+template <typename Container>
+class is_contiguous<Container, std::void_t<decltype(std::data(std::declval<Container&>()))>>
+    : public std::is_base_of<std::random_access_iterator_tag,
+                             typename std::iterator_traits<iterator_t<Container>>::iterator_category> {};
+
+/**
+ * @brief An element of a `trivial_tuple`.
+ *
+ * @tparam I The index of the element.
+ * @tparam T The type of the element.
+ */
+template <std::size_t I, typename T>
+class trivial_tuple_element {
+   public:
+    /**
+     * @brief Constructs the element.
+     *
+     * @param value The value of the element.
+     */
+    constexpr explicit trivial_tuple_element(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        : value_{value}
+    {
+    }
+
+    /**
+     * @brief Returns the element.
+     *
+     * @return A reference to the element.
+     */
+    constexpr T& get() noexcept { return value_; }
+
+    /**
+     * @brief Returns the element (const overload).
+     *
+     * @return A const reference to the element.
+     */
+    constexpr const T& get() const noexcept { return value_; }
+
+   private:
+    T value_;
+};
+
+template <typename Sequence, typename... T>
+class trivial_tuple_impl;
+
+/**
+ * @brief The elements of a `trivial_tuple`, each one identified by its index.
+ *
+ * @tparam I The indices of the elements.
+ * @tparam T The types of the elements.
+ */
+template <std::size_t... I, typename... T>
+class trivial_tuple_impl<std::index_sequence<I...>, T...> : public trivial_tuple_element<I, T>... {
+   public:
+    /**
+     * @brief Constructs the elements.
+     *
+     * @param values The values of the elements.
+     */
+    constexpr explicit trivial_tuple_impl(const T&... values) noexcept((std::is_nothrow_copy_constructible_v<T> && ...))
+        : trivial_tuple_element<I, T>{values}...
+    {
+    }
+};
+
+/**
+ * @brief A minimal tuple which, unlike `std::tuple`, is trivially copyable if all its elements are.
+ *
+ * Used to store iterators, so zipped iterators are trivially copyable when the zipped iterators are (e.g. pointers).
+ *
+ * @tparam T The types of the elements.
+ */
+template <typename... T>
+using trivial_tuple = trivial_tuple_impl<std::index_sequence_for<T...>, T...>;
+
+/**
+ * @brief Returns an element of a `trivial_tuple`.
+ *
+ * @tparam I The index of the element.
+ * @tparam T The type of the element.
+ * @param element The tuple, converted to its element.
+ * @return A reference to the element.
+ */
+template <std::size_t I, typename T>
+constexpr T& get(trivial_tuple_element<I, T>& element) noexcept
+{
+    return element.get();
+}
+
+/**
+ * @brief Returns an element of a `trivial_tuple` (const overload).
+ *
+ * @tparam I The index of the element.
+ * @tparam T The type of the element.
+ * @param element The tuple, converted to its element.
+ * @return A const reference to the element.
+ */
+template <std::size_t I, typename T>
+constexpr const T& get(const trivial_tuple_element<I, T>& element) noexcept
+{
+    return element.get();
+}
+
+/**
+ * @brief Checks if an iterator can be decremented without throwing.
+ *
+ * @tparam Iterator The type of the iterator.
+ */
+template <typename Iterator, typename = void>
+class is_nothrow_decrementable : public std::false_type {};
+
+/**
+ * @brief Checks if an iterator can be decremented without throwing.
+ *
+ * @tparam Iterator The type of the iterator.
+ */
+template <typename Iterator>
+class is_nothrow_decrementable<Iterator, std::void_t<decltype(--std::declval<Iterator&>())>>
+    : public std::bool_constant<noexcept(--std::declval<Iterator&>())> {};
+
+/**
+ * @brief Checks if an iterator can be moved by an offset (`+=`) without throwing.
+ *
+ * @tparam Iterator The type of the iterator.
+ */
+template <typename Iterator, typename = void>
+class is_nothrow_advanceable : public std::false_type {};
+
+/**
+ * @brief Checks if an iterator can be moved by an offset (`+=`) without throwing.
+ *
+ * @tparam Iterator The type of the iterator.
+ */
+template <typename Iterator>
+class is_nothrow_advanceable<Iterator, std::void_t<decltype(std::declval<Iterator&>() += std::ptrdiff_t{})>>
+    : public std::bool_constant<noexcept(std::declval<Iterator&>() += std::ptrdiff_t{})> {};
+
+/**
+ * @brief Checks if the distance between two iterators can be measured (`-`) without throwing.
+ *
+ * @tparam Iterator The type of the iterator.
+ */
+template <typename Iterator, typename = void>
+class is_nothrow_subtractable : public std::false_type {};
+
+/**
+ * @brief Checks if the distance between two iterators can be measured (`-`) without throwing.
+ *
+ * @tparam Iterator The type of the iterator.
+ */
+template <typename Iterator>
+class is_nothrow_subtractable<
+    Iterator, std::void_t<decltype(std::declval<const Iterator&>() - std::declval<const Iterator&>())>>
+    : public std::bool_constant<noexcept(std::declval<const Iterator&>() - std::declval<const Iterator&>())> {};
+
+/**
+ * @brief The number of elements of a container if it is known at compile time, `kDynamicExtent` otherwise.
+ *
+ * @tparam Container The type of the container.
+ */
+template <typename Container>
+class static_size : public std::integral_constant<std::size_t, kDynamicExtent> {};
+
+/**
+ * @brief The number of elements of a `std::array`.
+ *
+ * @tparam T The type of the elements.
+ * @tparam N The number of elements.
+ */
+template <typename T, std::size_t N>
+class static_size<std::array<T, N>> : public std::integral_constant<std::size_t, N> {};
+
+/**
+ * @brief The number of elements of a C array.
+ *
+ * @tparam T The type of the elements.
+ * @tparam N The number of elements.
+ */
+template <typename T, std::size_t N>
+class static_size<T[N]> : public std::integral_constant<std::size_t, N> {};
+
+/**
+ * @brief The number of elements of a container, ignoring references and cv-qualifiers.
+ *
+ * @tparam Container The type of the container.
+ */
+template <typename Container>
+inline constexpr std::size_t kStaticSize = static_size<std::remove_cv_t<std::remove_reference_t<Container>>>::value;
+
+}  // namespace detail
+
+/**
+ * @brief A range between two iterators, allowing to zip sequences which are not containers.
+ *
+ * @tparam Iterator The type of the iterators.
+ */
+template <typename Iterator>
+class iterator_range {
+   public:
+    /**
+     * @brief The iterator over the elements of the range.
+     */
+    using iterator = Iterator;
+
+    /**
+     * @brief The type of the elements of the range.
+     */
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+    /**
+     * @brief Constructs an `iterator_range` from two iterators.
+     *
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     */
+    constexpr iterator_range(Iterator first, Iterator last) : first_{first}, last_{last} {}
+
+    /**
+     * @brief Returns an iterator pointing to the beginning of the range.
+     *
+     * @return An iterator to the first element in the range.
+     */
+    constexpr Iterator begin() const { return first_; }
+
+    /**
+     * @brief Returns an iterator pointing to the end of the range.
+     *
+     * @return An iterator to the end of the range.
+     */
+    constexpr Iterator end() const { return last_; }
+
+    /**
+     * @brief Returns the elements of the range if they are stored in memory referenced by a pointer.
+     *
+     * @return A pointer to the first element in the range.
+     */
+    template <typename It = Iterator, std::enable_if_t<std::is_pointer_v<It>, int> = 0>
+    constexpr Iterator data() const
+    {
+        return first_;
+    }
+
+    /**
+     * @brief Returns the number of elements in the range.
+     *
+     * @return The number of elements in the range.
+     */
+    [[nodiscard]] constexpr std::size_t size() const { return static_cast<std::size_t>(std::distance(first_, last_)); }
+
+    /**
+     * @brief Checks if the range is empty.
+     *
+     * @return `true` if the range is empty, `false` otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const { return first_ == last_; }
+
+   private:
+    /**
+     * @brief The beginning of the range.
+     */
+    Iterator first_;
+
+    /**
+     * @brief The end of the range.
+     */
+    Iterator last_;
+};
+
+/**
+ * @brief Creates a range over raw memory, e.g. a memory mapped file or a network buffer, without copying it.
+ *
+ * @tparam T The type of the elements.
+ * @param data A pointer to the first element.
+ * @param size The number of elements.
+ * @return A range over the elements.
+ */
+template <typename T>
+constexpr iterator_range<T*> ptr_range(T* data, const std::size_t size)
+{
+    return iterator_range<T*>{data, data + size};
+}
+
+/**
+ * @brief A tuple of references to the elements of multiple sequences at the same position.
+ *
+ * It is a `std::tuple` of references (so it works with `std::get`, structured bindings and tuple comparisons) which
+ * behaves as a reference to a row of the zipped sequences: assigning to it assigns the referenced elements and
+ * swapping two of them swaps the referenced elements. This allows algorithms which move and swap elements (e.g.
+ * `std::sort`, `std::reverse`) to permute all zipped sequences together.
+ *
+ * @tparam References The types of the references to the elements.
+ */
+template <typename... References>
+class zip_reference : public std::tuple<References...> {
+   public:
+    using std::tuple<References...>::tuple;
+    using std::tuple<References...>::operator=;
+
+    /**
+     * @brief Constructs a `zip_reference` from a tuple of references.
+     *
+     * @param references The references to the elements.
+     */
+    constexpr explicit zip_reference(const std::tuple<References...>& references)
+        : std::tuple<References...>{references}
+    {
+    }
+
+    /**
+     * @brief Copies the referenced elements.
+     */
+    constexpr zip_reference(const zip_reference&) = default;
+
+    /**
+     * @brief Moves the referenced elements.
+     */
+    constexpr zip_reference(zip_reference&&) noexcept = default;
+
+    /**
+     * @brief Assigns the elements referenced by another `zip_reference` to the referenced elements.
+     *
+     * @param other The other `zip_reference`.
+     * @return A reference to this `zip_reference`.
+     */
+    zip_reference& operator=(const zip_reference& other)
+    {
+        std::tuple<References...>::operator=(other);
+        return *this;
+    }
+
+    /**
+     * @brief Assigns the elements referenced by another `zip_reference` to the referenced elements.
+     *
+     * @param other The other `zip_reference`.
+     * @return A reference to this `zip_reference`.
+     */
+    zip_reference& operator=(zip_reference&& other) noexcept(
+        std::is_nothrow_move_assignable_v<std::tuple<References...>>)
+    {
+        std::tuple<References...>::operator=(std::move(other));
+        return *this;
+    }
+
+    ~zip_reference() = default;
+
+    /**
+     * @brief Swaps the elements referenced by two `zip_reference` instances.
+     *
+     * Taking them by value allows swapping the rows pointed to by iterators: `swap(*a, *b)`.
+     *
+     * @param lhs The first `zip_reference`.
+     * @param rhs The second `zip_reference`.
+     */
+    friend void swap(zip_reference lhs,
+                     zip_reference rhs) noexcept(std::is_nothrow_swappable_v<std::tuple<References...>>)
+    {
+        static_cast<std::tuple<References...>&>(lhs).swap(static_cast<std::tuple<References...>&>(rhs));
+    }
+};
+
+namespace detail {
+
+/**
+ * @brief The type of an rvalue reference to the element referenced by a reference type.
+ *
+ * Proxy references (e.g. of `std::vector<bool>`) are kept as they are.
+ *
+ * @tparam Reference The reference type.
+ */
+template <typename Reference>
+using rvalue_reference_t =
+    std::conditional_t<std::is_reference_v<Reference>, std::remove_reference_t<Reference>&&, Reference>;
+
+/**
+ * @brief Casts the references of a `zip_reference` to rvalue references, allowing the elements to be moved.
+ *
+ * @tparam References The types of the references.
+ * @param reference The `zip_reference` to be cast.
+ * @return A tuple of rvalue references to the elements.
+ */
+template <typename... References>
+constexpr std::tuple<rvalue_reference_t<References>...> move_references(const zip_reference<References...>& reference)
+{
+    using rvalue_references = std::tuple<rvalue_reference_t<References>...>;
+
+    return std::apply(
+        [](auto&&... elements) { return rvalue_references{static_cast<rvalue_reference_t<References>>(elements)...}; },
+        static_cast<const std::tuple<References...>&>(reference));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Returns a comparator of rows of zipped sequences by the element of one of the sequences.
+ *
+ * @code
+ * std::sort(zip.begin(), zip.end(), msd::by<0>());
+ * @endcode
+ *
+ * @tparam I The index of the zipped sequence to compare by.
+ * @tparam Compare The type of the comparator of the elements.
+ * @param compare The comparator of the elements.
+ * @return A comparator of rows.
+ */
+template <std::size_t I, typename Compare = std::less<>>
+constexpr auto by(Compare compare = Compare{})
+{
+    return [compare](const auto& lhs, const auto& rhs) { return compare(std::get<I>(lhs), std::get<I>(rhs)); };
+}
+
+namespace detail {
+
+template <typename... References>
+class moving_reference;
+
+/**
+ * @brief A row moved out of zipped sequences by `msd::sort`, holding the values of the elements.
+ *
+ * @tparam Values The types of the values.
+ */
+template <typename... Values>
+class moved_row : public std::tuple<Values...> {
+   public:
+    /**
+     * @brief Moves the elements referenced by a row.
+     *
+     * @tparam References The types of the references.
+     * @param reference The row to move from.
+     */
+    template <typename... References>
+    moved_row(moving_reference<References...>&& reference)  // NOLINT(google-explicit-constructor)
+        : std::tuple<Values...>{move_references(reference)}
+    {
+    }
+
+    moved_row(const moved_row&) = default;
+    moved_row& operator=(const moved_row&) = default;
+    moved_row(moved_row&&) noexcept(std::is_nothrow_move_constructible_v<std::tuple<Values...>>) = default;
+    moved_row& operator=(moved_row&&) noexcept(std::is_nothrow_move_assignable_v<std::tuple<Values...>>) = default;
+    ~moved_row() = default;
+};
+
+/**
+ * @brief A row of zipped sequences used by `msd::sort`, which moves the referenced elements when it's assigned.
+ *
+ * The standard sorting algorithms only move rows (`std::move(*it)`), so assigning from a `moving_reference` always
+ * moves. It must not be exposed to code which copies through dereferenced iterators.
+ *
+ * @tparam References The types of the references to the elements.
+ */
+template <typename... References>
+class moving_reference : public zip_reference<References...> {
+   public:
+    using zip_reference<References...>::zip_reference;
+
+    moving_reference(const moving_reference&) = default;
+    moving_reference(moving_reference&&) noexcept = default;
+    ~moving_reference() = default;
+
+    /**
+     * @brief Moves the elements referenced by another row to the referenced elements.
+     *
+     * @param other The row to move from.
+     * @return A reference to this row.
+     */
+    moving_reference& operator=(const moving_reference& other)
+    {
+        std::tuple<References...>::operator=(move_references(other));
+        return *this;
+    }
+
+    /**
+     * @brief Moves the elements referenced by another row to the referenced elements.
+     *
+     * @param other The row to move from.
+     * @return A reference to this row.
+     */
+    moving_reference& operator=(moving_reference&& other)
+    {
+        return *this = static_cast<const moving_reference&>(other);
+    }
+
+    /**
+     * @brief Moves the values of a moved row to the referenced elements.
+     *
+     * @tparam Values The types of the values.
+     * @param row The row to move from.
+     * @return A reference to this row.
+     */
+    template <typename... Values>
+    moving_reference& operator=(moved_row<Values...>&& row)
+    {
+        std::tuple<References...>::operator=(static_cast<std::tuple<Values...>&&>(row));
+        return *this;
+    }
+};
+
+/**
+ * @brief A random access iterator over zipped sequences whose rows are moved when assigned, used by `msd::sort` to
+ * let the standard sorting algorithms move the elements instead of copying them.
+ *
+ * @tparam Iterator The type of the zip iterator.
+ * @tparam Values The types of the values of the elements.
+ * @tparam References The types of the references to the elements.
+ */
+template <typename Iterator, typename Values, typename References>
+class moving_iterator;
+
+/**
+ * @brief A random access iterator over zipped sequences whose rows are moved when assigned.
+ *
+ * @tparam Iterator The type of the zip iterator.
+ * @tparam Values The types of the values of the elements.
+ * @tparam References The types of the references to the elements.
+ */
+template <typename Iterator, typename... Values, typename... References>
+class moving_iterator<Iterator, std::tuple<Values...>, zip_reference<References...>> {
+   public:
+    /**
+     * @brief Supports random access traversal.
+     */
+    using iterator_category = std::random_access_iterator_tag;
+
+    /**
+     * @brief The difference between two iterators.
+     */
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+    /**
+     * @brief Rows are held by the sorting algorithms as moved rows.
+     */
+    using value_type = moved_row<Values...>;
+
+    /**
+     * @brief Rows moving their elements when assigned.
+     */
+    using reference = moving_reference<References...>;
+
+    /**
+     * @brief Rows are returned by value.
+     */
+    using pointer = void;
+
+    /**
+     * @brief Wraps a zip iterator.
+     *
+     * @param iterator The zip iterator.
+     */
+    explicit moving_iterator(const Iterator iterator) : iterator_{iterator} {}
+
+    /**
+     * @brief Returns the current row.
+     */
+    reference operator*() const { return reference{static_cast<const std::tuple<References...>&>(*iterator_)}; }
+
+    /**
+     * @brief Returns the row at an offset from the current one.
+     */
+    reference operator[](const difference_type offset) const { return *(*this + offset); }
+
+    /**
+     * @brief Moves to the next row.
+     */
+    moving_iterator& operator++()
+    {
+        ++iterator_;
+        return *this;
+    }
+
+    /**
+     * @brief Moves to the next row, returning the iterator before it was moved.
+     */
+    moving_iterator operator++(int)
+    {
+        auto copy = *this;
+        ++iterator_;
+        return copy;
+    }
+
+    /**
+     * @brief Moves to the previous row.
+     */
+    moving_iterator& operator--()
+    {
+        --iterator_;
+        return *this;
+    }
+
+    /**
+     * @brief Moves to the previous row, returning the iterator before it was moved.
+     */
+    moving_iterator operator--(int)
+    {
+        auto copy = *this;
+        --iterator_;
+        return copy;
+    }
+
+    /**
+     * @brief Moves the iterator by an offset.
+     */
+    moving_iterator& operator+=(const difference_type offset)
+    {
+        iterator_ += offset;
+        return *this;
+    }
+
+    /**
+     * @brief Moves the iterator back by an offset.
+     */
+    moving_iterator& operator-=(const difference_type offset)
+    {
+        iterator_ -= offset;
+        return *this;
+    }
+
+    /**
+     * @brief Returns an iterator moved by an offset.
+     */
+    moving_iterator operator+(const difference_type offset) const { return moving_iterator{iterator_ + offset}; }
+
+    /**
+     * @brief Returns an iterator moved by an offset.
+     */
+    friend moving_iterator operator+(const difference_type offset, const moving_iterator& it) { return it + offset; }
+
+    /**
+     * @brief Returns an iterator moved back by an offset.
+     */
+    moving_iterator operator-(const difference_type offset) const { return moving_iterator{iterator_ - offset}; }
+
+    /**
+     * @brief Returns the distance between two iterators.
+     */
+    difference_type operator-(const moving_iterator& other) const { return iterator_ - other.iterator_; }
+
+    /**
+     * @brief Checks if two iterators are equal.
+     */
+    bool operator==(const moving_iterator& other) const { return iterator_ == other.iterator_; }
+
+    /**
+     * @brief Checks if two iterators are not equal.
+     */
+    bool operator!=(const moving_iterator& other) const { return iterator_ != other.iterator_; }
+
+    /**
+     * @brief Checks if an iterator is before another one.
+     */
+    bool operator<(const moving_iterator& other) const { return iterator_ < other.iterator_; }
+
+    /**
+     * @brief Checks if an iterator is after another one.
+     */
+    bool operator>(const moving_iterator& other) const { return other.iterator_ < iterator_; }
+
+    /**
+     * @brief Checks if an iterator is before or at another one.
+     */
+    bool operator<=(const moving_iterator& other) const { return !(other.iterator_ < iterator_); }
+
+    /**
+     * @brief Checks if an iterator is after or at another one.
+     */
+    bool operator>=(const moving_iterator& other) const { return !(iterator_ < other.iterator_); }
+
+   private:
+    Iterator iterator_;
+};
+
+/**
+ * @brief Checks if a type is a `zip_reference`.
+ *
+ * @tparam T The type to be checked.
+ */
+template <typename T>
+class is_zip_reference : public std::false_type {};
+
+/**
+ * @brief Checks if a type is a `zip_reference`.
+ *
+ * @tparam References The types of the references.
+ */
+template <typename... References>
+class is_zip_reference<zip_reference<References...>> : public std::true_type {};
+
+}  // namespace detail
+
+/**
+ * @brief Sorts the rows of zipped sequences, moving their elements instead of copying them.
+ *
+ * `std::sort` can sort a zip, but C++17 algorithms hold rows in temporaries built from `std::move(*it)`. A dereferenced
+ * zip iterator is a `zip_reference` returned by value, which can't be told apart from a moved one, so the temporaries
+ * and the assignments between rows copy the elements (e.g. each string). This runs `std::sort` over iterators whose rows
+ * are moved when assigned, which is valid because sorting only moves rows. Other iterators are sorted by `std::sort`.
+ *
+ * @code
+ * msd::sort(zip.begin(), zip.end(), msd::by<0>());
+ * @endcode
+ *
+ * @tparam Iterator The type of the random access iterators.
+ * @tparam Compare The type of the comparator of the rows.
+ * @param first The beginning of the rows.
+ * @param last The end of the rows.
+ * @param compare The comparator of the rows.
+ */
+template <typename Iterator, typename Compare = std::less<>>
+void sort(const Iterator first, const Iterator last, Compare compare = Compare{})
+{
+    using traits = std::iterator_traits<Iterator>;
+
+    if constexpr (detail::is_zip_reference<typename traits::reference>::value) {
+        using iterator = detail::moving_iterator<Iterator, typename traits::value_type, typename traits::reference>;
+        std::sort(iterator{first}, iterator{last}, compare);
+    }
+    else {
+        std::sort(first, last, compare);
+    }
+}
+
+/**
+ * @brief Iterator over multiple iterators simultaneously.
+ *
+ * The iterator category is the weakest category of the zipped iterators. Random access operations are available only
+ * if all the zipped iterators are random access.
+ *
+ * @tparam Iterators Types of the iterators to be zipped. Input iterators are supported by single pass traversals (see
+ * `msd::streaming_zip`).
+ */
+template <typename... Iterators>
+class zip_iterator {
+   public:
+    /**
+     * @brief The weakest category of the zipped iterators.
+     */
+    using iterator_category = std::common_type_t<typename std::iterator_traits<Iterators>::iterator_category...>;
+
+    /**
+     * @brief The difference between two iterators.
+     */
+    using difference_type = std::ptrdiff_t;
+
+    /**
+     * @brief A tuple of values from each of the zipped iterators.
+     */
+    using value_type = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+
+    /**
+     * @brief A tuple of pointers from each of the zipped iterators.
+     */
+    using pointer = std::tuple<typename std::iterator_traits<Iterators>::pointer...>;
+
+    /**
+     * @brief A tuple of references from each of the zipped iterators.
+     */
+    using reference = zip_reference<typename std::iterator_traits<Iterators>::reference...>;
+
+   private:
+    /**
+     * @brief Whether all the zipped iterators are random access.
+     */
+    static constexpr bool kIsRandomAccess = std::is_base_of_v<std::random_access_iterator_tag, iterator_category>;
+
+    /**
+     * @brief Whether copying the zipped iterators does not throw.
+     */
+    static constexpr bool kNothrowCopy = (std::is_nothrow_copy_constructible_v<Iterators> && ...);
+
+    /**
+     * @brief Whether dereferencing the zipped iterators does not throw.
+     */
+    static constexpr bool kNothrowDereference =
+        (noexcept(*std::declval<const Iterators&>()) && ...) &&
+        std::is_nothrow_constructible_v<reference, typename std::iterator_traits<Iterators>::reference...>;
+
+    /**
+     * @brief Whether comparing the zipped iterators for equality does not throw.
+     */
+    static constexpr bool kNothrowEqual =
+        (noexcept(std::declval<const Iterators&>() == std::declval<const Iterators&>()) && ...);
+
+    /**
+     * @brief Whether incrementing the zipped iterators does not throw.
+     */
+    static constexpr bool kNothrowIncrement = (noexcept(++std::declval<Iterators&>()) && ...);
+
+    /**
+     * @brief Whether decrementing the zipped iterators does not throw.
+     */
+    static constexpr bool kNothrowDecrement = (detail::is_nothrow_decrementable<Iterators>::value && ...);
+
+    /**
+     * @brief Whether moving the zipped iterators by an offset does not throw (only random access iterators are moved
+     * in constant time; others are moved with `std::advance`, which may throw).
+     */
+    static constexpr bool kNothrowAdvance =
+        kIsRandomAccess && (detail::is_nothrow_advanceable<Iterators>::value && ...);
+
+    /**
+     * @brief Whether measuring the distance between the zipped iterators does not throw.
+     */
+    static constexpr bool kNothrowDistance = (detail::is_nothrow_subtractable<Iterators>::value && ...);
+
+    /**
+     * @brief The driver of iterators which don't have one: all the zipped iterators are compared.
+     */
+    static constexpr std::size_t kNoDriver = sizeof...(Iterators);
+
+   public:
+    /**
+     * @brief Constructs a `zip_iterator` from the provided iterators.
+     *
+     * @param iterators The iterators to be zipped together.
+     */
+    constexpr explicit zip_iterator(Iterators... iterators) noexcept(kNothrowCopy) : iterators_{iterators...} {}
+
+    /**
+     * @brief Dereferences the `zip_iterator` to obtain a tuple of references from each iterator.
+     *
+     * @return A tuple containing the values pointed to by each iterator.
+     */
+    constexpr reference operator*() const noexcept(kNothrowDereference)
+    {
+        return dereference(std::index_sequence_for<Iterators...>{});
+    }
+
+    /**
+     * @brief Returns the element at the specified offset from the current position.
+     *
+     * @param offset The offset of the element.
+     * @return A tuple containing the values at the specified offset.
+     */
+    template <typename Category = iterator_category, detail::enable_if_random_access_t<Category> = 0>
+    constexpr reference operator[](const difference_type offset) const
+        noexcept(kNothrowCopy && kNothrowAdvance && kNothrowDereference)
+    {
+        return *(*this + offset);
+    }
+
+    /**
+     * @brief Checks if two `zip_iterator` instances are equal.
+     *
+     * @param other The other `zip_iterator` to compare with.
+     * @return `true` if the iterators are equal, `false` otherwise.
+     */
+    constexpr bool operator==(const zip_iterator& other) const noexcept(kNothrowEqual)
+    {
+        return equal(std::index_sequence_for<Iterators...>{}, other);
+    }
+
+    /**
+     * @brief Checks if two `zip_iterator` instances are not equal.
+     *
+     * @param other The other `zip_iterator` to compare with.
+     * @return `true` if the iterators are not equal, `false` otherwise.
+     */
+    constexpr bool operator!=(const zip_iterator& other) const noexcept(kNothrowEqual)
+    {
+        return !equal(std::index_sequence_for<Iterators...>{}, other);
+    }
+
+    /**
+     * @brief Checks if the `zip_iterator` is before another one.
+     *
+     * @param other The other `zip_iterator` to compare with.
+     * @return `true` if the iterator is before the other one, `false` otherwise.
+     */
+    template <typename Category = iterator_category, detail::enable_if_random_access_t<Category> = 0>
+    constexpr bool operator<(const zip_iterator& other) const noexcept(kNothrowDistance)
+    {
+        return other - *this > 0;
+    }
+
+    /**
+     * @brief Checks if the `zip_iterator` is after another one.
+     *
+     * @param other The other `zip_iterator` to compare with.
+     * @return `true` if the iterator is after the other one, `false` otherwise.
+     */
+    template <typename Category = iterator_category, detail::enable_if_random_access_t<Category> = 0>
+    constexpr bool operator>(const zip_iterator& other) const noexcept(kNothrowDistance)
+    {
+        return other < *this;
+    }
+
+    /**
+     * @brief Checks if the `zip_iterator` is before or equal to another one.
+     *
+     * @param other The other `zip_iterator` to compare with.
+     * @return `true` if the iterator is not after the other one, `false` otherwise.
+     */
+    template <typename Category = iterator_category, detail::enable_if_random_access_t<Category> = 0>
+    constexpr bool operator<=(const zip_iterator& other) const noexcept(kNothrowDistance)
+    {
+        return !(other < *this);
+    }
+
+    /**
+     * @brief Checks if the `zip_iterator` is after or equal to another one.
+     *
+     * @param other The other `zip_iterator` to compare with.
+     * @return `true` if the iterator is not before the other one, `false` otherwise.
+     */
+    template <typename Category = iterator_category, detail::enable_if_random_access_t<Category> = 0>
+    constexpr bool operator>=(const zip_iterator& other) const noexcept(kNothrowDistance)
+    {
+        return !(*this < other);
+    }
+
+    /**
+     * @brief Advances the `zip_iterator` by one position.
+     *
+     * @return A reference to the updated `zip_iterator`.
+     */
+    constexpr zip_iterator& operator++() noexcept(kNothrowIncrement)
+    {
+        increment(std::index_sequence_for<Iterators...>{});
+        return *this;
+    }
+
+    /**
+     * @brief Advances the `zip_iterator` by one position.
+     *
+     * @return A copy of the `zip_iterator` before it was advanced.
+     */
+    constexpr zip_iterator operator++(int) noexcept(kNothrowCopy && kNothrowIncrement)
+    {
+        auto iterator = *this;
+        ++*this;
+        return iterator;
+    }
+
+    /**
+     * @brief Advances the `zip_iterator` by a specified offset.
+     *
+     * @param offset The number of positions to advance.
+     * @return A reference to the updated `zip_iterator`.
+     */
+    template <typename Category = iterator_category, detail::enable_if_random_access_t<Category> = 0>
+    constexpr zip_iterator& operator+=(const difference_type offset) noexcept(kNothrowAdvance)
+    {
+        advance(std::index_sequence_for<Iterators...>{}, offset);
+        return *this;
+    }
+
+    /**
+     * @brief Returns a new `zip_iterator` advanced by a specified offset.
+     *
+     * @param offset The number of positions to advance.
+     * @return A new `zip_iterator` advanced by the specified offset.
+     */
+    constexpr zip_iterator operator+(const difference_type offset) const noexcept(kNothrowCopy && kNothrowAdvance)
+    {
+        auto iterator = *this;
+        iterator.advance(std::index_sequence_for<Iterators...>{}, offset);
+        return iterator;
+    }
+
+    /**
+     * @brief Returns a new `zip_iterator` advanced by a specified offset.
+     *
+     * @param offset The number of positions to advance.
+     * @param iterator The `zip_iterator` to be advanced.
+     * @return A new `zip_iterator` advanced by the specified offset.
+     */
+    template <typename Category = iterator_category, detail::enable_if_random_access_t<Category> = 0>
+    friend constexpr zip_iterator operator+(const difference_type offset, const zip_iterator& iterator) noexcept(
+        kNothrowCopy && kNothrowAdvance)
+    {
+        return iterator + offset;
+    }
+
+    /**
+     * @brief Casts the elements pointed to by a `zip_iterator` to rvalue references, allowing them to be moved.
+     *
+     * @param iterator The `zip_iterator` to be dereferenced.
+     * @return A tuple of rvalue references to the elements.
+     */
+    friend constexpr auto iter_move(const zip_iterator& iterator) { return detail::move_references(*iterator); }
+
+    /**
+     * @brief Swaps the elements pointed to by two `zip_iterator` instances.
+     *
+     * @param lhs The first `zip_iterator`.
+     * @param rhs The second `zip_iterator`.
+     */
+    friend void iter_swap(const zip_iterator& lhs, const zip_iterator& rhs) { swap(*lhs, *rhs); }
+
+    /**
+     * @brief Returns a new `zip_iterator` advanced by the distance between two iterators.
+     *
+     * @param other The `zip_iterator` to measure the distance to.
+     * @return A new `zip_iterator` advanced by the distance to the specified iterator.
+     */
+    constexpr zip_iterator operator+(const zip_iterator& other) const
+    {
+        auto iterator = *this;
+        const auto distance = std::distance(iterator, other);
+        iterator.advance(std::index_sequence_for<Iterators...>{}, distance);
+        return iterator;
+    }
+
+    /**
+     * @brief Moves the `zip_iterator` back by one position.
+     *
+     * @return A reference to the updated `zip_iterator`.
+     */
+    constexpr zip_iterator& operator--() noexcept(kNothrowDecrement)
+    {
+        decrement(std::index_sequence_for<Iterators...>{});
+        return *this;
+    }
+
+    /**
+     * @brief Moves the `zip_iterator` back by one position.
+     *
+     * @return A copy of the `zip_iterator` before it was moved.
+     */
+    constexpr zip_iterator operator--(int) noexcept(kNothrowCopy && kNothrowDecrement)
+    {
+        auto iterator = *this;
+        --*this;
+        return iterator;
+    }
+
+    /**
+     * @brief Moves the `zip_iterator` back by a specified offset.
+     *
+     * @param offset The number of positions to move back.
+     * @return A reference to the updated `zip_iterator`.
+     */
+    template <typename Category = iterator_category, detail::enable_if_random_access_t<Category> = 0>
+    constexpr zip_iterator& operator-=(const difference_type offset) noexcept(kNothrowAdvance)
+    {
+        advance(std::index_sequence_for<Iterators...>{}, -offset);
+        return *this;
+    }
+
+    /**
+     * @brief Returns a new `zip_iterator` moved back by a specified offset.
+     *
+     * @param offset The number of positions to move back.
+     * @return A new `zip_iterator` moved back by the specified offset.
+     */
+    constexpr zip_iterator operator-(const difference_type offset) const noexcept(kNothrowCopy && kNothrowAdvance)
+    {
+        auto iterator = *this;
+        iterator.advance(std::index_sequence_for<Iterators...>{}, -offset);
+        return iterator;
+    }
+
+    /**
+     * @brief Returns the distance between two `zip_iterator` instances.
+     *
+     * The distance is the shortest one between the zipped iterators, as the iterators are considered equal when any of
+     * the zipped iterators are equal.
+     *
+     * @param other The `zip_iterator` to measure the distance from.
+     * @return The number of positions between the specified iterator and this one.
+     */
+    template <typename Category = iterator_category, detail::enable_if_random_access_t<Category> = 0>
+    constexpr difference_type operator-(const zip_iterator& other) const noexcept(kNothrowDistance)
+    {
+        return distance(std::index_sequence_for<Iterators...>{}, other);
+    }
+
+   private:
+    template <typename... Containers>
+    friend class zip;
+
+    /**
+     * @brief Constructs a `zip_iterator` which compares only the iterators of the shortest zipped sequence.
+     *
+     * @param driver The index of the shortest zipped sequence.
+     * @param iterators The iterators to be zipped together.
+     */
+    constexpr zip_iterator(const std::size_t driver, Iterators... iterators) noexcept(kNothrowCopy)
+        : iterators_{iterators...}, driver_{driver}
+    {
+    }
+
+    /**
+     * @brief Dereferences the `zip_iterator`.
+     *
+     * @tparam I Indices used to unpack the tuple of iterators.
+     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of iterators.
+     * @return A tuple containing the values pointed to by each iterator.
+     */
+    template <std::size_t... I>
+    constexpr reference dereference(std::index_sequence<I...>) const
+    {
+        return reference{*detail::get<I>(iterators_)...};
+    }
+
+    /**
+     * @brief Compares two `zip_iterator` instances for equality.
+     *
+     * @tparam I Indices used to unpack the tuple of iterators.
+     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of iterators.
+     * Iterators created by the same zip compare only the iterators of the shortest zipped sequence (the driver), as
+     * the other iterators can't reach their end before it. Otherwise, the iterators are equal if any of the zipped
+     * iterators are equal.
+     *
+     * @param other The other `zip_iterator` to compare with.
+     * @return `true` if the iterators are equal, `false` otherwise.
+     */
+    template <std::size_t... I>
+    constexpr bool equal(std::index_sequence<I...>, const zip_iterator& other) const noexcept(kNothrowEqual)
+    {
+        if (driver_ != kNoDriver && driver_ == other.driver_) {
+            bool result = false;
+            static_cast<void>(
+                ((I == driver_ && ((result = detail::get<I>(iterators_) == detail::get<I>(other.iterators_)), true)) ||
+                 ...));
+            return result;
+        }
+
+        return ((detail::get<I>(iterators_) == detail::get<I>(other.iterators_)) || ...);
+    }
+
+    /**
+     * @brief Advances the zipped iterators by one position.
+     *
+     * @tparam I Indices used to unpack the tuple of iterators.
+     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of iterators.
+     */
+    template <std::size_t... I>
+    constexpr void increment(std::index_sequence<I...>) noexcept(kNothrowIncrement)
+    {
+        (++detail::get<I>(iterators_), ...);
+    }
+
+    /**
+     * @brief Moves the zipped iterators back by one position.
+     *
+     * @tparam I Indices used to unpack the tuple of iterators.
+     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of iterators.
+     */
+    template <std::size_t... I>
+    constexpr void decrement(std::index_sequence<I...>) noexcept(kNothrowDecrement)
+    {
+        (--detail::get<I>(iterators_), ...);
+    }
+
+    /**
+     * @brief Advances the `zip_iterator` by a specified offset.
+     *
+     * @tparam I Indices used to unpack the tuple of iterators.
+     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of iterators.
+     * @param offset The number of positions to advance.
+     */
+    template <std::size_t... I>
+    constexpr void advance(std::index_sequence<I...>, const difference_type offset) noexcept(kNothrowAdvance)
+    {
+        if constexpr (kIsRandomAccess) {
+            ((detail::get<I>(iterators_) += offset), ...);
+        }
+        else {
+            (std::advance(detail::get<I>(iterators_), offset), ...);
+        }
+    }
+
+    /**
+     * @brief Measures the shortest distance between the zipped iterators of two `zip_iterator` instances.
+     *
+     * @tparam I Indices used to unpack the tuple of iterators.
+     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of iterators.
+     * @param other The `zip_iterator` to measure the distance from.
+     * @return The distance with the smallest magnitude.
+     */
+    template <std::size_t... I>
+    constexpr difference_type distance(std::index_sequence<I...>, const zip_iterator& other) const
+        noexcept(kNothrowDistance)
+    {
+        const std::array<difference_type, sizeof...(Iterators)> distances{
+            static_cast<difference_type>(detail::get<I>(iterators_) - detail::get<I>(other.iterators_))...};
+        const auto magnitude = [](const difference_type value) noexcept { return value < 0 ? -value : value; };
+
+        difference_type shortest = distances[0];
+        for (const auto value : distances) {
+            if (magnitude(value) < magnitude(shortest)) {
+                shortest = value;
+            }
+        }
+        return shortest;
+    }
+
+    /**
+     * @brief A list of the iterators being zipped.
+     */
+    detail::trivial_tuple<Iterators...> iterators_;
+
+    /**
+     * @brief The index of the shortest zipped sequence, if the iterator was created by a zip, `kNoDriver` otherwise.
+     */
+    std::size_t driver_{kNoDriver};
+};
+
+/**
+ * @brief Random access iterator over multiple random access iterators simultaneously, using a single offset.
+ *
+ * Stores the beginning of each zipped sequence once and a single offset shared by all of them, so advancing is one
+ * addition and comparing is one comparison regardless of the number of zipped sequences. This allows compilers to
+ * vectorize loops over zipped contiguous containers.
+ *
+ * Only iterators over the same zipped sequences can be compared.
+ *
+ * @tparam Iterators Types of the iterators to be zipped. Each iterator must be random access.
+ */
+template <typename... Iterators>
+class offset_zip_iterator {
+   public:
+    static_assert((std::is_base_of_v<std::random_access_iterator_tag,
+                                     typename std::iterator_traits<Iterators>::iterator_category> &&
+                   ...),
+                  "offset_zip_iterator requires random access iterators");
+
+    /**
+     * @brief Supports random access traversal.
+     */
+    using iterator_category = std::random_access_iterator_tag;
+
+    /**
+     * @brief The difference between two iterators.
+     */
+    using difference_type = std::ptrdiff_t;
+
+    /**
+     * @brief A tuple of values from each of the zipped iterators.
+     */
+    using value_type = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+
+    /**
+     * @brief A tuple of pointers from each of the zipped iterators.
+     */
+    using pointer = std::tuple<typename std::iterator_traits<Iterators>::pointer...>;
+
+    /**
+     * @brief A tuple of references from each of the zipped iterators.
+     */
+    using reference = zip_reference<typename std::iterator_traits<Iterators>::reference...>;
+
+   private:
+    /**
+     * @brief Whether copying the iterators to the beginning of the sequences does not throw.
+     */
+    static constexpr bool kNothrowCopy = (std::is_nothrow_copy_constructible_v<Iterators> && ...);
+
+    /**
+     * @brief Whether accessing the elements at an offset from the beginning of the sequences does not throw.
+     */
+    static constexpr bool kNothrowDereference =
+        (noexcept(std::declval<const Iterators&>()[difference_type{}]) && ...) &&
+        std::is_nothrow_constructible_v<reference, typename std::iterator_traits<Iterators>::reference...>;
+
+   public:
+    /**
+     * @brief Constructs an `offset_zip_iterator` from the provided offset and the beginning of each sequence.
+     *
+     * @param offset The position in the zipped sequences.
+     * @param bases The beginning of each of the sequences to be zipped together.
+     */
+    constexpr explicit offset_zip_iterator(const difference_type offset, Iterators... bases) noexcept(kNothrowCopy)
+        : bases_{bases...}, offset_{offset}
+    {
+    }
+
+    /**
+     * @brief Dereferences the `offset_zip_iterator` to obtain a tuple of references from each sequence.
+     *
+     * @return A tuple containing the values at the current offset.
+     */
+    constexpr reference operator*() const noexcept(kNothrowDereference)
+    {
+        return dereference(std::index_sequence_for<Iterators...>{}, offset_);
+    }
+
+    /**
+     * @brief Returns the element at the specified offset from the current position.
+     *
+     * @param offset The offset of the element.
+     * @return A tuple containing the values at the specified offset.
+     */
+    constexpr reference operator[](const difference_type offset) const noexcept(kNothrowDereference)
+    {
+        return dereference(std::index_sequence_for<Iterators...>{}, offset_ + offset);
+    }
+
+    /**
+     * @brief Checks if two `offset_zip_iterator` instances are equal.
+     *
+     * @param other The other `offset_zip_iterator` to compare with.
+     * @return `true` if the iterators are at the same offset, `false` otherwise.
+     */
+    constexpr bool operator==(const offset_zip_iterator& other) const noexcept { return offset_ == other.offset_; }
+
+    /**
+     * @brief Checks if two `offset_zip_iterator` instances are not equal.
+     *
+     * @param other The other `offset_zip_iterator` to compare with.
+     * @return `true` if the iterators are not at the same offset, `false` otherwise.
+     */
+    constexpr bool operator!=(const offset_zip_iterator& other) const noexcept { return offset_ != other.offset_; }
+
+    /**
+     * @brief Checks if the `offset_zip_iterator` is before another one.
+     *
+     * @param other The other `offset_zip_iterator` to compare with.
+     * @return `true` if the iterator is before the other one, `false` otherwise.
+     */
+    constexpr bool operator<(const offset_zip_iterator& other) const noexcept { return offset_ < other.offset_; }
+
+    /**
+     * @brief Checks if the `offset_zip_iterator` is after another one.
+     *
+     * @param other The other `offset_zip_iterator` to compare with.
+     * @return `true` if the iterator is after the other one, `false` otherwise.
+     */
+    constexpr bool operator>(const offset_zip_iterator& other) const noexcept { return offset_ > other.offset_; }
+
+    /**
+     * @brief Checks if the `offset_zip_iterator` is before or equal to another one.
+     *
+     * @param other The other `offset_zip_iterator` to compare with.
+     * @return `true` if the iterator is not after the other one, `false` otherwise.
+     */
+    constexpr bool operator<=(const offset_zip_iterator& other) const noexcept { return offset_ <= other.offset_; }
+
+    /**
+     * @brief Checks if the `offset_zip_iterator` is after or equal to another one.
+     *
+     * @param other The other `offset_zip_iterator` to compare with.
+     * @return `true` if the iterator is not before the other one, `false` otherwise.
+     */
+    constexpr bool operator>=(const offset_zip_iterator& other) const noexcept { return offset_ >= other.offset_; }
+
+    /**
+     * @brief Advances the `offset_zip_iterator` by one position.
+     *
+     * @return A reference to the updated `offset_zip_iterator`.
+     */
+    constexpr offset_zip_iterator& operator++() noexcept
+    {
+        ++offset_;
+        return *this;
+    }
+
+    /**
+     * @brief Advances the `offset_zip_iterator` by one position.
+     *
+     * @return A copy of the `offset_zip_iterator` before it was advanced.
+     */
+    constexpr offset_zip_iterator operator++(int) noexcept(kNothrowCopy)
+    {
+        auto iterator = *this;
+        ++offset_;
+        return iterator;
+    }
+
+    /**
+     * @brief Advances the `offset_zip_iterator` by a specified offset.
+     *
+     * @param offset The number of positions to advance.
+     * @return A reference to the updated `offset_zip_iterator`.
+     */
+    constexpr offset_zip_iterator& operator+=(const difference_type offset) noexcept
+    {
+        offset_ += offset;
+        return *this;
+    }
+
+    /**
+     * @brief Returns a new `offset_zip_iterator` advanced by a specified offset.
+     *
+     * @param offset The number of positions to advance.
+     * @return A new `offset_zip_iterator` advanced by the specified offset.
+     */
+    constexpr offset_zip_iterator operator+(const difference_type offset) const noexcept(kNothrowCopy)
+    {
+        auto iterator = *this;
+        iterator += offset;
+        return iterator;
+    }
+
+    /**
+     * @brief Returns a new `offset_zip_iterator` advanced by a specified offset.
+     *
+     * @param offset The number of positions to advance.
+     * @param iterator The `offset_zip_iterator` to be advanced.
+     * @return A new `offset_zip_iterator` advanced by the specified offset.
+     */
+    friend constexpr offset_zip_iterator operator+(const difference_type offset,
+                                                   const offset_zip_iterator& iterator) noexcept(kNothrowCopy)
+    {
+        return iterator + offset;
+    }
+
+    /**
+     * @brief Casts the elements pointed to by a `offset_zip_iterator` to rvalue references, allowing them to be moved.
+     *
+     * @param iterator The `offset_zip_iterator` to be dereferenced.
+     * @return A tuple of rvalue references to the elements.
+     */
+    friend constexpr auto iter_move(const offset_zip_iterator& iterator) { return detail::move_references(*iterator); }
+
+    /**
+     * @brief Swaps the elements pointed to by two `offset_zip_iterator` instances.
+     *
+     * @param lhs The first `offset_zip_iterator`.
+     * @param rhs The second `offset_zip_iterator`.
+     */
+    friend void iter_swap(const offset_zip_iterator& lhs, const offset_zip_iterator& rhs) { swap(*lhs, *rhs); }
+
+    /**
+     * @brief Moves the `offset_zip_iterator` back by one position.
+     *
+     * @return A reference to the updated `offset_zip_iterator`.
+     */
+    constexpr offset_zip_iterator& operator--() noexcept
+    {
+        --offset_;
+        return *this;
+    }
+
+    /**
+     * @brief Moves the `offset_zip_iterator` back by one position.
+     *
+     * @return A copy of the `offset_zip_iterator` before it was moved.
+     */
+    constexpr offset_zip_iterator operator--(int) noexcept(kNothrowCopy)
+    {
+        auto iterator = *this;
+        --offset_;
+        return iterator;
+    }
+
+    /**
+     * @brief Moves the `offset_zip_iterator` back by a specified offset.
+     *
+     * @param offset The number of positions to move back.
+     * @return A reference to the updated `offset_zip_iterator`.
+     */
+    constexpr offset_zip_iterator& operator-=(const difference_type offset) noexcept
+    {
+        offset_ -= offset;
+        return *this;
+    }
+
+    /**
+     * @brief Returns a new `offset_zip_iterator` moved back by a specified offset.
+     *
+     * @param offset The number of positions to move back.
+     * @return A new `offset_zip_iterator` moved back by the specified offset.
+     */
+    constexpr offset_zip_iterator operator-(const difference_type offset) const noexcept(kNothrowCopy)
+    {
+        auto iterator = *this;
+        iterator -= offset;
+        return iterator;
+    }
+
+    /**
+     * @brief Returns the distance between two `offset_zip_iterator` instances.
+     *
+     * @param other The `offset_zip_iterator` to measure the distance from.
+     * @return The number of positions between the specified iterator and this one.
+     */
+    constexpr difference_type operator-(const offset_zip_iterator& other) const noexcept
+    {
+        return offset_ - other.offset_;
+    }
+
+   private:
+    /**
+     * @brief Dereferences the `offset_zip_iterator` at a given offset.
+     *
+     * @tparam I Indices used to unpack the tuple of iterators.
+     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of iterators.
+     * @param offset The offset of the values from the beginning of the sequences.
+     * @return A tuple containing the values at the given offset.
+     */
+    template <std::size_t... I>
+    constexpr reference dereference(std::index_sequence<I...>, const difference_type offset) const
+        noexcept(kNothrowDereference)
+    {
+        return reference{detail::get<I>(bases_)[offset]...};
+    }
+
+    /**
+     * @brief The beginning of each of the zipped sequences.
+     */
+    detail::trivial_tuple<Iterators...> bases_;
+
+    /**
+     * @brief The position in the zipped sequences.
+     */
+    difference_type offset_;
+};
+
+/**
+ * @brief A part of a zipped sequence, between two iterators.
+ *
+ * @tparam Iterator The type of the iterators of the zipped sequence.
+ */
+template <typename Iterator>
+class zip_range {
+   public:
+    /**
+     * @brief The iterator over the elements of the range.
+     */
+    using iterator = Iterator;
+
+    /**
+     * @brief A tuple of values of the elements of the zipped containers.
+     */
+    using value_type = typename Iterator::value_type;
+
+    /**
+     * @brief A tuple of references to the elements of the zipped containers.
+     */
+    using reference = typename Iterator::reference;
+
+    /**
+     * @brief The difference between two iterators of the range.
+     */
+    using difference_type = typename Iterator::difference_type;
+
+    /**
+     * @brief Constructs a `zip_range` from two iterators of a zipped sequence.
+     *
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     */
+    constexpr zip_range(Iterator first, Iterator last) : first_{first}, last_{last} {}
+
+    /**
+     * @brief Returns an iterator pointing to the beginning of the range.
+     *
+     * @return An iterator to the first element in the range.
+     */
+    constexpr Iterator begin() const { return first_; }
+
+    /**
+     * @brief Returns an iterator pointing to the end of the range.
+     *
+     * @return An iterator to the end of the range.
+     */
+    constexpr Iterator end() const { return last_; }
+
+    /**
+     * @brief Returns the number of elements in the range.
+     *
+     * @return The number of elements in the range.
+     */
+    [[nodiscard]] constexpr std::size_t size() const { return static_cast<std::size_t>(std::distance(first_, last_)); }
+
+    /**
+     * @brief Checks if the range is empty.
+     *
+     * @return `true` if the range is empty, `false` otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const { return first_ == last_; }
+
+    /**
+     * @brief Returns the first element in the range.
+     *
+     * @pre The range must not be empty.
+     * @return The first element in the range.
+     */
+    constexpr reference front() const
+    {
+        assert(!empty());  // LCOV_EXCL_LINE
+        return *first_;
+    }
+
+    /**
+     * @brief Returns the element at the specified offset in the range.
+     *
+     * @param offset The index of the element to retrieve.
+     * @pre The offset must be less than the size of the range.
+     * @return The element at the specified offset.
+     */
+    constexpr reference operator[](const std::size_t offset) const
+    {
+        assert(offset < size());
+        return *std::next(first_, static_cast<difference_type>(offset));
+    }
+
+   private:
+    /**
+     * @brief The beginning of the range.
+     */
+    Iterator first_;
+
+    /**
+     * @brief The end of the range.
+     */
+    Iterator last_;
+};
+
+/**
+ * @brief Forward iterator over consecutive chunks of a zipped sequence.
  *
- * @tparam Iterators Types of the iterators to be zipped. Each iterator should support bidirectional iteration
- *                   (i.e., it should support `++`, `--`, and dereferencing).
+ * @tparam Iterator The type of the iterators of the zipped sequence.
  */
-template <typename... Iterators>
-class zip_iterator {
+template <typename Iterator>
+class zip_chunk_iterator {
    public:
     /**
-     * @brief Supports bidirectional traversal.
+     * @brief Supports forward traversal.
      */
-    using iterator_category = std::bidirectional_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
 
     /**
      * @brief The difference between two iterators.
      */
-    using difference_type = std::ptrdiff_t;
+    using difference_type = typename Iterator::difference_type;
 
     /**
-     * @brief A tuple of references from each of the zipped iterators.
+     * @brief A chunk of the zipped sequence.
      */
-    using value_type = std::tuple<typename std::iterator_traits<Iterators>::reference...>;
+    using value_type = zip_range<Iterator>;
 
     /**
-     * @brief A tuple of pointers from each of the zipped iterators.
+     * @brief Chunks are returned by value.
      */
-    using pointer = std::tuple<typename std::iterator_traits<Iterators>::pointer...>;
+    using pointer = void;
 
     /**
-     * @brief A tuple of references from each of the zipped iterators.
+     * @brief Chunks are returned by value.
      */
-    using reference = std::tuple<typename std::iterator_traits<Iterators>::reference...>;
+    using reference = value_type;
 
     /**
-     * @brief Constructs a `zip_iterator` from the provided iterators.
+     * @brief Constructs a `zip_chunk_iterator` at the beginning of a chunk.
      *
-     * @param iterators The iterators to be zipped together.
+     * @param first The beginning of the chunk.
+     * @param last The end of the zipped sequence.
+     * @param size The maximum number of elements in a chunk.
      */
-    explicit zip_iterator(Iterators... iterators) : iterators_{iterators...} {}
+    constexpr zip_chunk_iterator(Iterator first, Iterator last, const difference_type size)
+        : first_{first}, next_{boundary(first, last, size)}, last_{last}, size_{size}
+    {
+    }
 
     /**
-     * @brief Dereferences the `zip_iterator` to obtain a tuple of references from each iterator.
+     * @brief Returns the current chunk.
      *
-     * @return A tuple containing the values pointed to by each iterator.
+     * @return A range over at most `size` elements of the zipped sequence.
      */
-    value_type operator*() const { return dereference(std::index_sequence_for<Iterators...>{}); }
+    constexpr value_type operator*() const { return value_type{first_, next_}; }
 
     /**
-     * @brief Checks if two `zip_iterator` instances are equal.
+     * @brief Checks if two `zip_chunk_iterator` instances are equal.
      *
-     * @param other The other `zip_iterator` to compare with.
-     * @return `true` if the iterators are equal, `false` otherwise.
+     * @param other The other `zip_chunk_iterator` to compare with.
+     * @return `true` if the iterators point to the same chunk, `false` otherwise.
      */
-    bool operator==(const zip_iterator& other) const { return equal(std::index_sequence_for<Iterators...>{}, other); }
+    constexpr bool operator==(const zip_chunk_iterator& other) const { return first_ == other.first_; }
 
     /**
-     * @brief Checks if two `zip_iterator` instances are not equal.
+     * @brief Checks if two `zip_chunk_iterator` instances are not equal.
      *
-     * @param other The other `zip_iterator` to compare with.
-     * @return `true` if the iterators are not equal, `false` otherwise.
+     * @param other The other `zip_chunk_iterator` to compare with.
+     * @return `true` if the iterators point to different chunks, `false` otherwise.
      */
-    bool operator!=(const zip_iterator& other) const { return !equal(std::index_sequence_for<Iterators...>{}, other); }
+    constexpr bool operator!=(const zip_chunk_iterator& other) const { return !(*this == other); }
 
     /**
-     * @brief Advances the `zip_iterator` by one position.
+     * @brief Advances the `zip_chunk_iterator` to the next chunk.
      *
-     * @return A reference to the updated `zip_iterator`.
+     * @return A reference to the updated `zip_chunk_iterator`.
      */
-    zip_iterator& operator++()
+    constexpr zip_chunk_iterator& operator++()
     {
-        advance(std::index_sequence_for<Iterators...>{}, 1);
+        first_ = next_;
+        next_ = boundary(first_, last_, size_);
         return *this;
     }
 
     /**
-     * @brief Returns a new `zip_iterator` advanced by a specified offset.
+     * @brief Advances the `zip_chunk_iterator` to the next chunk.
      *
-     * @param offset The number of positions to advance.
-     * @return A new `zip_iterator` advanced by the specified offset.
+     * @return A copy of the `zip_chunk_iterator` before it was advanced.
      */
-    zip_iterator operator+(const std::size_t offset) const
+    constexpr zip_chunk_iterator operator++(int)
     {
         auto iterator = *this;
-        iterator.advance(std::index_sequence_for<Iterators...>{}, offset);
+        ++*this;
         return iterator;
     }
 
+   private:
     /**
-     * @brief Returns a new `zip_iterator` advanced by the distance between two iterators.
+     * @brief Finds the end of the chunk starting at a given position, without going past the end of the sequence.
      *
-     * @param other The `zip_iterator` to measure the distance to.
-     * @return A new `zip_iterator` advanced by the distance to the specified iterator.
+     * @param first The beginning of the chunk.
+     * @param last The end of the zipped sequence.
+     * @param size The maximum number of elements in a chunk.
+     * @return The end of the chunk.
      */
-    zip_iterator operator+(const zip_iterator& other) const
+    static constexpr Iterator boundary(Iterator first, const Iterator& last, const difference_type size)
     {
-        auto iterator = *this;
-        const auto distance = std::distance(iterator, other);
-        iterator.advance(std::index_sequence_for<Iterators...>{}, distance);
-        return iterator;
+        if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename Iterator::iterator_category>) {
+            return first + std::min(size, last - first);
+        }
+        else {
+            for (difference_type i = 0; i < size && first != last; ++i) {
+                ++first;
+            }
+            return first;
+        }
     }
 
     /**
-     * @brief Moves the `zip_iterator` back by one position.
+     * @brief The beginning of the current chunk.
+     */
+    Iterator first_;
+
+    /**
+     * @brief The end of the current chunk.
+     */
+    Iterator next_;
+
+    /**
+     * @brief The end of the zipped sequence.
+     */
+    Iterator last_;
+
+    /**
+     * @brief The maximum number of elements in a chunk.
+     */
+    difference_type size_;
+};
+
+/**
+ * @brief A view over consecutive chunks of a zipped sequence, each having at most a given number of elements.
+ *
+ * @tparam Iterator The type of the iterators of the zipped sequence.
+ */
+template <typename Iterator>
+class zip_chunks {
+   public:
+    /**
+     * @brief Iterator over the chunks.
+     */
+    using iterator = zip_chunk_iterator<Iterator>;
+
+    /**
+     * @brief A chunk of the zipped sequence.
+     */
+    using value_type = zip_range<Iterator>;
+
+    /**
+     * @brief Constructs a `zip_chunks` view over a zipped sequence.
      *
-     * @return A reference to the updated `zip_iterator`.
+     * @param first The beginning of the zipped sequence.
+     * @param last The end of the zipped sequence.
+     * @param size The maximum number of elements in a chunk. It's clamped to the range of `difference_type`, and zero
+     * is taken as one, so the chunks always move forward.
      */
-    zip_iterator& operator--()
+    constexpr zip_chunks(Iterator first, Iterator last, const std::size_t size)
+        : first_{first}, last_{last}, size_{clamp(size)}
     {
-        advance(std::index_sequence_for<Iterators...>{}, -1);
-        return *this;
     }
 
     /**
-     * @brief Returns a new `zip_iterator` moved back by a specified offset.
+     * @brief Returns an iterator to the first chunk.
      *
-     * @param offset The number of positions to move back.
-     * @return A new `zip_iterator` moved back by the specified offset.
+     * @return An iterator to the first chunk.
      */
-    zip_iterator operator-(const int offset) const
-    {
-        auto iterator = *this;
-        iterator.advance(std::index_sequence_for<Iterators...>{}, -offset);
-        return iterator;
-    }
+    constexpr iterator begin() const { return iterator{first_, last_, size_}; }
 
     /**
-     * @brief Returns the distance between two `zip_iterator` instances.
+     * @brief Returns an iterator past the last chunk.
      *
-     * @param other The `zip_iterator` to measure the distance from.
-     * @return A new `zip_iterator` moved back by the distance to the specified iterator.
+     * @return An iterator past the last chunk.
+     */
+    constexpr iterator end() const { return iterator{last_, last_, size_}; }
+
+    /**
+     * @brief Returns the number of chunks.
+     *
+     * @return The number of chunks.
      */
-    zip_iterator operator-(const zip_iterator& other) const
+    [[nodiscard]] constexpr std::size_t size() const
     {
-        auto iterator = *this;
-        const auto distance = std::distance(other, iterator);
-        iterator.advance(std::index_sequence_for<Iterators...>{}, -distance);
-        return iterator;
+        const auto elements = std::distance(first_, last_);
+        return static_cast<std::size_t>(elements / size_ + (elements % size_ != 0 ? 1 : 0));
     }
 
+    /**
+     * @brief Checks if there are no chunks.
+     *
+     * @return `true` if there are no chunks, `false` otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const { return first_ == last_; }
+
    private:
     /**
-     * @brief Dereferences the `zip_iterator`.
+     * @brief The beginning of the zipped sequence.
+     */
+    Iterator first_;
+
+    /**
+     * @brief The end of the zipped sequence.
+     */
+    Iterator last_;
+
+    /**
+     * @brief The maximum number of elements in a chunk.
+     */
+    typename Iterator::difference_type size_;
+
+    /**
+     * @brief Converts a chunk size to a positive difference between iterators.
      *
-     * @tparam I Indices used to unpack the tuple of iterators.
-     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of iterators.
-     * @return A tuple containing the values pointed to by each iterator.
+     * @param size The requested chunk size.
+     * @return The size, between one and the largest `difference_type`.
      */
-    template <std::size_t... I>
-    value_type dereference(std::index_sequence<I...>) const
+    static constexpr typename Iterator::difference_type clamp(const std::size_t size) noexcept
     {
-        return std::tie(*std::get<I>(iterators_)...);
+        using difference_type = typename Iterator::difference_type;
+        constexpr auto kMax = static_cast<std::size_t>(std::numeric_limits<difference_type>::max());
+        return static_cast<difference_type>(std::clamp(size, std::size_t{1}, kMax));
     }
+};
+
+namespace detail {
+
+/**
+ * @brief The type of the pointer to the elements of a contiguous container.
+ *
+ * @tparam Container The type of the container.
+ */
+template <typename Container>
+using data_t = decltype(std::data(std::declval<Container&>()));
 
+/**
+ * @brief Checks if a zip can walk a container with a single offset from a base, as it does for contiguous containers.
+ *
+ * Contiguous containers qualify, with their data as the base. Other random access types whose elements are computed
+ * from a base iterator and an offset (e.g. `msd::iota`) opt in by specializing this and `offset_base`.
+ *
+ * @tparam Container The type of the container to be checked, without cv-qualifiers.
+ */
+template <typename Container, typename = void>
+class has_offset_base : public is_contiguous<Container> {};
+
+/**
+ * @brief Returns the base from which a zip walks a container with a single offset.
+ *
+ * @tparam Container The type of the container, without cv-qualifiers.
+ */
+template <typename Container>
+class offset_base {
+   public:
     /**
-     * @brief Compares two `zip_iterator` instances for equality.
+     * @brief Returns the data of a contiguous container.
      *
-     * @tparam I Indices used to unpack the tuple of iterators.
-     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of iterators.
-     * @param other The other `zip_iterator` to compare with.
-     * @return `true` if all iterators are equal, `false` otherwise.
+     * @tparam C The type of the container, possibly const.
+     * @param container The container.
+     * @return A pointer to the first element.
      */
-    template <std::size_t... I>
-    bool equal(std::index_sequence<I...>, const zip_iterator& other) const
+    template <typename C>
+    static constexpr auto get(C& container) noexcept(noexcept(std::data(container)))
     {
-        return ((std::get<I>(iterators_) == std::get<I>(other.iterators_)) || ...);
+        return std::data(container);
     }
+};
+
+/**
+ * @brief The type of the base from which a zip walks a container with a single offset.
+ *
+ * @tparam Container The type of the container, possibly const.
+ */
+template <typename Container>
+using base_t = decltype(offset_base<std::remove_cv_t<Container>>::get(std::declval<Container&>()));
+
+/**
+ * @brief The type of a zipped container as given by the zip arguments: lvalues are referenced by the zip (`Container`),
+ * rvalues are moved into the zip (`Container&&`).
+ *
+ * @tparam Argument The type of the argument, as deduced by a forwarding reference.
+ */
+template <typename Argument>
+using zip_container_t = std::conditional_t<std::is_lvalue_reference_v<Argument>, std::remove_reference_t<Argument>,
+                                           std::remove_reference_t<Argument>&&>;
 
+/**
+ * @brief A container owned by a zip.
+ *
+ * The zip is a view, so its constness does not apply to the owned containers, like for the referenced ones.
+ *
+ * @tparam Container The type of the owned container.
+ */
+template <typename Container>
+class owned_container {
+   public:
     /**
-     * @brief Advances the `zip_iterator` by a specified offset.
+     * @brief Moves a container into the `owned_container`.
      *
-     * @tparam I Indices used to unpack the tuple of iterators.
-     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of iterators.
-     * @param offset The number of positions to advance.
+     * @param container The container to be owned.
      */
-    template <std::size_t... I>
-    void advance(std::index_sequence<I...>, const int offset)
+    constexpr explicit owned_container(Container&& container) noexcept(
+        std::is_nothrow_move_constructible_v<Container>)
+        : container_{std::move(container)}
     {
-        ((std::advance(std::get<I>(iterators_), offset)), ...);
     }
 
     /**
-     * @brief A list of the iterators being zipped.
+     * @brief Returns the owned container.
+     *
+     * @return A reference to the owned container.
+     */
+    constexpr Container& get() const noexcept { return container_; }
+
+   private:
+    mutable Container container_;
+};
+
+/**
+ * @brief Returns a referenced container.
+ *
+ * @tparam Container The type of the container.
+ * @param container The referenced container.
+ * @return A reference to the container.
+ */
+template <typename Container>
+constexpr Container& unwrap(Container& container) noexcept
+{
+    return container;
+}
+
+/**
+ * @brief Returns an owned container.
+ *
+ * @tparam Container The type of the container.
+ * @param container The owned container.
+ * @return A reference to the container.
+ */
+template <typename Container>
+constexpr Container& unwrap(const owned_container<Container>& container) noexcept
+{
+    return container.get();
+}
+
+/**
+ * @brief The type used to store a zipped container: rvalue references are owned, other containers are referenced.
+ *
+ * @tparam Container The type of the zipped container.
+ */
+template <typename Container>
+using zip_storage_t = std::conditional_t<std::is_rvalue_reference_v<Container>,
+                                         owned_container<std::remove_reference_t<Container>>,
+                                         std::remove_reference_t<Container>&>;
+
+/**
+ * @brief The type of the parameter used to pass a zipped container to the zip.
+ *
+ * @tparam Container The type of the zipped container.
+ */
+template <typename Container>
+using zip_parameter_t =
+    std::conditional_t<std::is_rvalue_reference_v<Container>, Container, std::remove_reference_t<Container>&>;
+
+/**
+ * @brief Selects the iterator used to zip containers.
+ *
+ * @tparam HasOffsetBase Whether all the containers can be walked with a single offset.
+ * @tparam Containers The types of the containers to be zipped.
+ */
+template <bool HasOffsetBase, typename... Containers>
+class zip_iterator_for {
+   public:
+    /**
+     * @brief Iterator over the iterators of the containers.
+     */
+    using type = zip_iterator<iterator_t<Containers>...>;
+};
+
+/**
+ * @brief Selects the iterator used to zip contiguous containers, or other containers walked with a single offset.
+ *
+ * @tparam Containers The types of the containers to be zipped.
+ */
+template <typename... Containers>
+class zip_iterator_for<true, Containers...> {
+   public:
+    /**
+     * @brief Iterator over the elements of the containers using a single offset.
      */
-    std::tuple<Iterators...> iterators_;
+    using type = offset_zip_iterator<base_t<Containers>...>;
 };
 
+}  // namespace detail
+
 /**
  * @brief A view over multiple containers simultaneously.
  *        It allows iterating through multiple containers at once, stopping at the shortest container.
  *
+ * Containers given as lvalues are referenced, so they must outlive the zip. Containers given as rvalues are moved into
+ * the zip, which owns them (their type is deduced as `Container&&`).
+ *
  * @note The zip never throws explicitly any exception. It all depends on what the given containers throw.
  *
  * @tparam Containers The types of the containers to be zipped.
- *                    Each container must support standard iteration
- *                    (must have `begin()`, `end()`, `cbegin()`, and `cend()` methods).
+ *                    Each container must be a range supported by `std::begin()` and `std::end()`
+ *                    (e.g. standard containers, C arrays, `std::string_view`, `msd::iterator_range`).
+ *                    Rvalue reference types are owned by the zip, other types are referenced.
  */
 template <typename... Containers>
 class zip {
    public:
     static_assert(sizeof...(Containers) > 1, "zip requires at least 2 containers");
 
+   private:
+    /**
+     * @brief Whether all the containers can be walked with a single offset (e.g. they store their elements
+     * contiguously).
+     */
+    static constexpr bool kHasOffsetBase =
+        (detail::has_offset_base<std::remove_cv_t<std::remove_reference_t<Containers>>>::value && ...);
+
+    /**
+     * @brief Whether the sizes of all the containers are known without traversing them.
+     */
+    static constexpr bool kHasSizes = (detail::has_size<std::remove_reference_t<Containers>>::value && ...);
+
+    /**
+     * @brief Whether storing the containers does not throw: referencing never throws, owning moves the containers.
+     */
+    static constexpr bool kNothrowConstructible =
+        (std::is_nothrow_constructible_v<detail::zip_storage_t<Containers>, detail::zip_parameter_t<Containers>> &&
+         ...);
+
+   public:
+    /**
+     * @brief The size of the zipped sequence if all containers have a size known at compile time (`std::array`, C
+     * arrays), `kDynamicExtent` otherwise.
+     */
+    static constexpr std::size_t kExtent = (... && (detail::kStaticSize<Containers> != kDynamicExtent))
+                                               ? std::min({detail::kStaticSize<Containers>...})
+                                               : kDynamicExtent;
+
     /**
      * @brief A composite iterator that iterates over all provided containers in parallel.
      *
-     *
      * It is constructed based on whether the containers are const or non-const.
+     * If all containers are contiguous (or opt in with `detail::has_offset_base`), the iterator walks over their
+     * elements with a single offset.
      */
-    using iterator =
-        zip_iterator<typename std::conditional_t<std::is_const_v<Containers>, typename Containers::const_iterator,
-                                                 typename Containers::iterator>...>;
+    using iterator = typename detail::zip_iterator_for<kHasOffsetBase, std::remove_reference_t<Containers>...>::type;
+
     /**
      * @brief A composite iterator that iterates over all provided containers in parallel.
      *
      * Guarantees that the containers are not modified.
      */
-    using const_iterator = zip_iterator<typename Containers::const_iterator...>;
+    using const_iterator =
+        typename detail::zip_iterator_for<kHasOffsetBase, const std::remove_reference_t<Containers>...>::type;
 
     /**
-     * @brief The value_type is the type of the element returned by the iterator, which is a tuple of
-     * elements from each container.
+     * @brief The value_type is a tuple of values of the elements from each container.
      */
     using value_type = typename iterator::value_type;
 
+    /**
+     * @brief The reference is the type of the element returned by the iterator, which is a tuple of
+     * references to the elements from each container.
+     */
+    using reference = typename iterator::reference;
+
+    /**
+     * @brief The difference between two iterators of the zipped sequence.
+     */
+    using difference_type = typename iterator::difference_type;
+
     /**
      * @brief Constructs a `zip` object from the provided containers.
      *
-     * @param containers The containers to be zipped together.
+     * @param containers The containers to be zipped together. Rvalue containers are moved into the zip.
      * @pre At least two containers must be provided.
      */
-    explicit zip(Containers&... containers) : containers_{containers...} {}
+    constexpr explicit zip(detail::zip_parameter_t<Containers>... containers) noexcept(kNothrowConstructible)
+        : containers_{std::forward<detail::zip_parameter_t<Containers>>(containers)...}
+    {
+    }
 
     /**
      * @brief Returns an iterator pointing to the beginning of the zipped containers.
      *
      * @return An iterator to the first element in the zipped sequence.
      */
-    iterator begin() const { return begin_impl<iterator>(std::index_sequence_for<Containers...>{}); }
+    constexpr iterator begin() const { return begin_impl<iterator>(std::index_sequence_for<Containers...>{}); }
 
     /**
      * @brief Returns an iterator pointing to the end of the zipped containers.
      *
+     * If all containers are bidirectional, the end is positioned after the last element of the zipped sequence, so it
+     * can be moved back. Otherwise (forward only containers), the end holds the end of each container and it's reached
+     * when any container reaches its end.
+     *
      * @return An iterator to the end of the zipped sequence.
      */
-    iterator end() const { return end_impl<iterator>(std::index_sequence_for<Containers...>{}); }
+    constexpr iterator end() const { return end_impl<iterator>(std::index_sequence_for<Containers...>{}); }
 
     /**
      * @brief Returns a const iterator pointing to the beginning of the zipped containers.
      *
      * @return A const iterator to the first element in the zipped sequence.
      */
-    const_iterator cbegin() const { return begin_impl<const_iterator>(std::index_sequence_for<Containers...>{}); }
+    constexpr const_iterator cbegin() const
+    {
+        return begin_impl<const_iterator>(std::index_sequence_for<Containers...>{});
+    }
 
     /**
      * @brief Returns a const iterator pointing to the end of the zipped containers.
      *
+     * @see end()
+     *
      * @return A const iterator to the end of the zipped sequence.
      */
-    const_iterator cend() const { return end_impl<const_iterator>(std::index_sequence_for<Containers...>{}); }
+    constexpr const_iterator cend() const { return end_impl<const_iterator>(std::index_sequence_for<Containers...>{}); }
 
     /**
      * @brief Returns the size of the zipped sequence, which is the size of the smallest container.
      *
+     * The size of each container is obtained in constant time if the container provides it, otherwise by traversing
+     * the container. If all containers have a size known at compile time, the size is a constant expression (see
+     * `kExtent`), so loops over the zipped sequence can be unrolled.
+     *
      * @return The number of elements in the zipped sequence.
      */
-    [[nodiscard]] std::size_t size() const { return size_impl(std::index_sequence_for<Containers...>{}); }
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        if constexpr (kExtent != kDynamicExtent) {
+            return kExtent;
+        }
+        else {
+            return size_impl(std::index_sequence_for<Containers...>{});
+        }
+    }
 
     /**
      * @brief Checks if the zipped sequence is empty.
      *
      * @return `true` if the zipped sequence is empty, `false` otherwise.
      */
-    [[nodiscard]] bool empty() const { return begin() == end(); }
+    [[nodiscard]] constexpr bool empty() const { return begin() == end(); }
 
     /**
      * @brief Allows the `zip` object to be used in a boolean context, indicating whether the zipped sequence is
@@ -291,7 +2250,7 @@ class zip {
      *
      * @return `true` if the zipped sequence is non-empty, `false` otherwise.
      */
-    explicit operator bool() const { return !empty(); }
+    constexpr explicit operator bool() const { return !empty(); }
 
     /**
      * @brief Returns the first element in the zipped sequence.
@@ -299,7 +2258,7 @@ class zip {
      * @pre The zipped sequence must not be empty.
      * @return The first element in the zipped sequence.
      */
-    value_type front()
+    constexpr reference front()
     {
         assert(!empty());  // LCOV_EXCL_LINE
         return *begin();
@@ -311,7 +2270,7 @@ class zip {
      * @pre The zipped sequence must not be empty.
      * @return The first element in the zipped sequence.
      */
-    value_type front() const
+    constexpr reference front() const
     {
         assert(!empty());  // LCOV_EXCL_LINE
         return *begin();
@@ -323,10 +2282,10 @@ class zip {
      * @pre The zipped sequence must not be empty.
      * @return The last element in the zipped sequence.
      */
-    value_type back()
+    constexpr reference back()
     {
         assert(!empty());  // LCOV_EXCL_LINE
-        return *std::prev(begin() + size());
+        return *std::next(begin(), static_cast<difference_type>(size()) - 1);
     }
 
     /**
@@ -335,10 +2294,10 @@ class zip {
      * @pre The zipped sequence must not be empty.
      * @return The last element in the zipped sequence.
      */
-    value_type back() const
+    constexpr reference back() const
     {
         assert(!empty());  // LCOV_EXCL_LINE
-        return *std::prev(begin() + size());
+        return *std::next(begin(), static_cast<difference_type>(size()) - 1);
     }
 
     /**
@@ -348,10 +2307,24 @@ class zip {
      * @pre The offset must be less than the size of the zipped sequence.
      * @return Reference to the element at the specified offset.
      */
-    value_type operator[](const std::size_t offset) const
+    constexpr reference operator[](const std::size_t offset) const
     {
         assert(offset < size());
-        return *std::next(begin(), offset);
+        return *std::next(begin(), static_cast<difference_type>(offset));
+    }
+
+    /**
+     * @brief Splits the zipped sequence into consecutive chunks.
+     *
+     * Each chunk is a range over at most `size` elements of the zipped sequence; only the last chunk can be smaller.
+     * Chunks can be processed independently, e.g. by multiple threads or to fit the elements into a cache.
+     *
+     * @param size The maximum number of elements in a chunk. Zero is taken as one.
+     * @return A view over the chunks.
+     */
+    constexpr zip_chunks<iterator> chunks(const std::size_t size) const
+    {
+        return zip_chunks<iterator>{begin(), end(), size};
     }
 
    private:
@@ -364,23 +2337,92 @@ class zip {
      * @return An iterator to the beginning of the zipped sequence.
      */
     template <typename Iterator, std::size_t... I>
-    Iterator begin_impl(std::index_sequence<I...>) const
+    constexpr Iterator begin_impl(std::index_sequence<I...>) const
     {
-        return Iterator{std::get<I>(containers_).begin()...};
+        if constexpr (kHasOffsetBase) {
+            return Iterator{0, detail::offset_base<std::remove_cv_t<std::remove_reference_t<Containers>>>::get(
+                                   container<I>())...};
+        }
+        else if constexpr (kHasSizes) {
+            return Iterator{driver(std::index_sequence<I...>{}), std::begin(container<I>())...};
+        }
+        else {
+            return Iterator{std::begin(container<I>())...};
+        }
     }
 
     /**
      * @brief Constructs the end iterator of the zipped sequence.
      *
+     * Random access iterators are moved from the beginning by the size of the zipped sequence. Bidirectional iterators
+     * must also be aligned on the last row, as they can be moved back: each one is the end of its container moved back
+     * by the elements past the shortest container (constant time if the containers have the same size), or the
+     * beginning moved forward if that's shorter. Forward only iterators hold the end of each container, avoiding a
+     * traversal of the containers.
+     *
      * @tparam Iterator Type of the iterator to be constructed.
      * @tparam I Indices used to unpack the tuple of containers.
      * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of containers.
      * @return An iterator to the end of the zipped sequence.
      */
     template <typename Iterator, std::size_t... I>
-    Iterator end_impl(std::index_sequence<I...>) const
+    constexpr Iterator end_impl(std::index_sequence<I...>) const
+    {
+        using category = typename Iterator::iterator_category;
+
+        if constexpr (std::is_base_of_v<std::random_access_iterator_tag, category>) {
+            return begin_impl<Iterator>(std::index_sequence<I...>{}) + static_cast<difference_type>(size());
+        }
+        else if constexpr (std::is_base_of_v<std::bidirectional_iterator_tag, category> && kHasSizes) {
+            const std::array<std::size_t, sizeof...(Containers)> sizes{detail::container_size(container<I>())...};
+            const auto shortest = std::min_element(sizes.begin(), sizes.end());
+            return Iterator{static_cast<std::size_t>(shortest - sizes.begin()),
+                            aligned_end<I>(std::get<I>(sizes), *shortest)...};
+        }
+        else if constexpr (std::is_base_of_v<std::bidirectional_iterator_tag, category>) {
+            return std::next(begin_impl<Iterator>(std::index_sequence<I...>{}), static_cast<difference_type>(size()));
+        }
+        else if constexpr (kHasSizes) {
+            return Iterator{driver(std::index_sequence<I...>{}), std::end(container<I>())...};
+        }
+        else {
+            return Iterator{std::end(container<I>())...};
+        }
+    }
+
+    /**
+     * @brief Returns the iterator of a bidirectional container after the last row of the zipped sequence.
+     *
+     * @tparam I The index of the container.
+     * @param container_size The size of the container.
+     * @param size The size of the zipped sequence.
+     * @return The end of the container moved back by the elements past the last row, or the beginning moved forward
+     * by the size of the zipped sequence, whichever takes fewer steps.
+     */
+    template <std::size_t I>
+    constexpr auto aligned_end(const std::size_t container_size, const std::size_t size) const
     {
-        return std::next(Iterator{std::get<I>(containers_).begin()...}, size());
+        const auto extra = container_size - size;
+        if (extra <= size) {
+            return std::prev(std::end(container<I>()), static_cast<difference_type>(extra));
+        }
+        return std::next(std::begin(container<I>()), static_cast<difference_type>(size));
+    }
+
+    /**
+     * @brief Finds the shortest container, which drives the comparisons of the iterators.
+     *
+     * It's found each time iterators are created, as the referenced containers can change their size.
+     *
+     * @tparam I Indices used to unpack the tuple of containers.
+     * @param std::index_sequence<I...> A compile-time sequence used to unpack the tuple of containers.
+     * @return The index of the shortest container.
+     */
+    template <std::size_t... I>
+    constexpr std::size_t driver(std::index_sequence<I...>) const
+    {
+        const std::array<std::size_t, sizeof...(Containers)> sizes{detail::container_size(container<I>())...};
+        return static_cast<std::size_t>(std::min_element(sizes.begin(), sizes.end()) - sizes.begin());
     }
 
     /**
@@ -391,17 +2433,58 @@ class zip {
      * @return The size of the zipped sequence.
      */
     template <std::size_t... I>
-    std::size_t size_impl(std::index_sequence<I...>) const
+    constexpr std::size_t size_impl(std::index_sequence<I...>) const
+    {
+        return std::min({detail::container_size(container<I>())...});
+    }
+
+    /**
+     * @brief Returns one of the zipped containers.
+     *
+     * @tparam I The index of the container.
+     * @return A reference to the container.
+     */
+    template <std::size_t I>
+    constexpr auto& container() const noexcept
     {
-        return std::min({std::distance(std::get<I>(containers_).begin(), std::get<I>(containers_).end())...});
+        return detail::unwrap(std::get<I>(containers_));
     }
 
     /**
-     * @brief A list of references to the containers being zipped.
+     * @brief A list of the containers being zipped: references to the referenced ones, values for the owned ones.
      */
-    std::tuple<Containers&...> containers_;
+    std::tuple<detail::zip_storage_t<Containers>...> containers_;
 };
 
+/**
+ * @brief Deduces the types of the zipped containers: lvalues are referenced, rvalues are owned.
+ *
+ * @tparam Containers The types of the containers to be zipped.
+ */
+template <typename... Containers>
+zip(Containers&&...) -> zip<detail::zip_container_t<Containers>...>;
+
 }  // namespace msd
 
+namespace std {
+
+/**
+ * @brief The number of references in a `msd::zip_reference`, used by structured bindings.
+ *
+ * @tparam References The types of the references.
+ */
+template <typename... References>
+struct tuple_size<msd::zip_reference<References...>> : integral_constant<size_t, sizeof...(References)> {};
+
+/**
+ * @brief The type of a reference in a `msd::zip_reference`, used by structured bindings.
+ *
+ * @tparam I The index of the reference.
+ * @tparam References The types of the references.
+ */
+template <size_t I, typename... References>
+struct tuple_element<I, msd::zip_reference<References...>> : tuple_element<I, tuple<References...>> {};
+
+}  // namespace std
+
 #endif  // MSD_ZIP_ZIP_HPP
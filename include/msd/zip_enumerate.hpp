@@ -0,0 +1,353 @@
+#ifndef MSD_ZIP_ZIP_ENUMERATE_HPP
+#define MSD_ZIP_ZIP_ENUMERATE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "zip.hpp"
+
+namespace msd {
+
+/**
+ * @brief A range of consecutive indices computed on the fly, usable as a zip column instead of a container of indices.
+ *
+ * The indices are not stored: each one is the beginning of the range plus the position in the range.
+ */
+class iota {
+   public:
+    /**
+     * @brief Random access iterator over the indices, holding the current index.
+     */
+    class iterator {
+       public:
+        /**
+         * @brief Supports random access traversal.
+         */
+        using iterator_category = std::random_access_iterator_tag;
+
+        /**
+         * @brief The difference between two iterators.
+         */
+        using difference_type = std::ptrdiff_t;
+
+        /**
+         * @brief The type of the indices.
+         */
+        using value_type = std::size_t;
+
+        /**
+         * @brief Indices are returned by value.
+         */
+        using reference = std::size_t;
+
+        /**
+         * @brief Indices are not stored, so they can't be pointed to.
+         */
+        using pointer = void;
+
+        /**
+         * @brief Constructs an iterator at index zero.
+         */
+        constexpr iterator() noexcept = default;
+
+        /**
+         * @brief Constructs an iterator at an index.
+         *
+         * @param index The current index.
+         */
+        constexpr explicit iterator(const std::size_t index) noexcept : index_{index} {}
+
+        /**
+         * @brief Returns the current index.
+         *
+         * @return The current index.
+         */
+        constexpr std::size_t operator*() const noexcept { return index_; }
+
+        /**
+         * @brief Returns the index at an offset from the current one.
+         *
+         * @param offset The offset.
+         * @return The index at the offset.
+         */
+        constexpr std::size_t operator[](const difference_type offset) const noexcept
+        {
+            return index_ + static_cast<std::size_t>(offset);
+        }
+
+        /**
+         * @brief Moves to the next index.
+         *
+         * @return A reference to the updated iterator.
+         */
+        constexpr iterator& operator++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+
+        /**
+         * @brief Moves to the next index.
+         *
+         * @return A copy of the iterator before it was moved.
+         */
+        constexpr iterator operator++(int) noexcept
+        {
+            auto copy = *this;
+            ++index_;
+            return copy;
+        }
+
+        /**
+         * @brief Moves to the previous index.
+         *
+         * @return A reference to the updated iterator.
+         */
+        constexpr iterator& operator--() noexcept
+        {
+            --index_;
+            return *this;
+        }
+
+        /**
+         * @brief Moves to the previous index.
+         *
+         * @return A copy of the iterator before it was moved.
+         */
+        constexpr iterator operator--(int) noexcept
+        {
+            auto copy = *this;
+            --index_;
+            return copy;
+        }
+
+        /**
+         * @brief Moves the iterator by an offset.
+         *
+         * @param offset The offset.
+         * @return A reference to the updated iterator.
+         */
+        constexpr iterator& operator+=(const difference_type offset) noexcept
+        {
+            index_ += static_cast<std::size_t>(offset);
+            return *this;
+        }
+
+        /**
+         * @brief Moves the iterator back by an offset.
+         *
+         * @param offset The offset.
+         * @return A reference to the updated iterator.
+         */
+        constexpr iterator& operator-=(const difference_type offset) noexcept
+        {
+            index_ -= static_cast<std::size_t>(offset);
+            return *this;
+        }
+
+        /**
+         * @brief Returns an iterator moved by an offset.
+         *
+         * @param offset The offset.
+         * @return The moved iterator.
+         */
+        constexpr iterator operator+(const difference_type offset) const noexcept
+        {
+            auto copy = *this;
+            return copy += offset;
+        }
+
+        /**
+         * @brief Returns an iterator moved by an offset.
+         *
+         * @param offset The offset.
+         * @param it The iterator.
+         * @return The moved iterator.
+         */
+        friend constexpr iterator operator+(const difference_type offset, const iterator& it) noexcept
+        {
+            return it + offset;
+        }
+
+        /**
+         * @brief Returns an iterator moved back by an offset.
+         *
+         * @param offset The offset.
+         * @return The moved iterator.
+         */
+        constexpr iterator operator-(const difference_type offset) const noexcept
+        {
+            auto copy = *this;
+            return copy -= offset;
+        }
+
+        /**
+         * @brief Returns the distance between two iterators.
+         *
+         * @param other The other iterator.
+         * @return The difference of the indices.
+         */
+        constexpr difference_type operator-(const iterator& other) const noexcept
+        {
+            return static_cast<difference_type>(index_ - other.index_);
+        }
+
+        /**
+         * @brief Checks if two iterators are equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the indices are equal, `false` otherwise.
+         */
+        constexpr bool operator==(const iterator& other) const noexcept { return index_ == other.index_; }
+
+        /**
+         * @brief Checks if two iterators are not equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the indices are not equal, `false` otherwise.
+         */
+        constexpr bool operator!=(const iterator& other) const noexcept { return index_ != other.index_; }
+
+        /**
+         * @brief Checks if an iterator is before another one.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the index is smaller than the other one, `false` otherwise.
+         */
+        constexpr bool operator<(const iterator& other) const noexcept { return index_ < other.index_; }
+
+        /**
+         * @brief Checks if an iterator is after another one.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the index is greater than the other one, `false` otherwise.
+         */
+        constexpr bool operator>(const iterator& other) const noexcept { return other < *this; }
+
+        /**
+         * @brief Checks if an iterator is before or at another one.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the index is not greater than the other one, `false` otherwise.
+         */
+        constexpr bool operator<=(const iterator& other) const noexcept { return !(other < *this); }
+
+        /**
+         * @brief Checks if an iterator is after or at another one.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the index is not smaller than the other one, `false` otherwise.
+         */
+        constexpr bool operator>=(const iterator& other) const noexcept { return !(*this < other); }
+
+       private:
+        std::size_t index_{0};
+    };
+
+    /**
+     * @brief The type of the indices.
+     */
+    using value_type = std::size_t;
+
+    /**
+     * @brief Constructs an unbounded range starting at zero, whose size is limited by the other columns of a zip.
+     */
+    constexpr iota() noexcept = default;
+
+    /**
+     * @brief Constructs a range of indices from zero to `last`.
+     *
+     * @param last The index past the last one.
+     */
+    constexpr explicit iota(const std::size_t last) noexcept : last_{last} {}
+
+    /**
+     * @brief Constructs a range of indices from `first` to `last`.
+     *
+     * @param first The first index.
+     * @param last The index past the last one.
+     */
+    constexpr iota(const std::size_t first, const std::size_t last) noexcept : first_{first}, last_{last} {}
+
+    /**
+     * @brief Returns an iterator to the first index.
+     *
+     * @return An iterator to the beginning of the range.
+     */
+    constexpr iterator begin() const noexcept { return iterator{first_}; }
+
+    /**
+     * @brief Returns an iterator past the last index.
+     *
+     * @return An iterator to the end of the range.
+     */
+    constexpr iterator end() const noexcept { return iterator{last_}; }
+
+    /**
+     * @brief Returns the number of indices.
+     *
+     * @return The number of indices.
+     */
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return last_ - first_; }
+
+    /**
+     * @brief Checks if the range is empty.
+     *
+     * @return `true` if the range is empty, `false` otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept { return first_ == last_; }
+
+   private:
+    std::size_t first_{0};
+    std::size_t last_{static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max())};
+};
+
+namespace detail {
+
+/**
+ * @brief An `iota` is walked with a single offset from its first index, so a zip of an `iota` and contiguous containers
+ * is iterated as a zip of contiguous containers: the index of each row is computed from the offset.
+ */
+template <>
+class has_offset_base<iota> : public std::true_type {};
+
+/**
+ * @brief Returns the base from which the indices of an `iota` are computed with an offset.
+ */
+template <>
+class offset_base<iota> {
+   public:
+    /**
+     * @brief Returns an iterator to the first index.
+     *
+     * @param range The range of indices.
+     * @return An iterator to the beginning of the range.
+     */
+    static constexpr iota::iterator get(const iota& range) noexcept { return range.begin(); }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Zips containers with their indices, without storing the indices.
+ *
+ * @code
+ * for (auto [index, a, b] : msd::enumerate_zip(as, bs)) {}
+ * @endcode
+ *
+ * @tparam Containers The types of the containers.
+ * @param containers The containers. Lvalues are referenced, rvalues are moved into the zip.
+ * @return A zip of an unbounded `iota` and the containers, stopping at the shortest container.
+ */
+template <typename... Containers>
+constexpr auto enumerate_zip(Containers&&... containers)
+{
+    return zip(iota{}, std::forward<Containers>(containers)...);
+}
+
+}  // namespace msd
+
+#endif  // MSD_ZIP_ZIP_ENUMERATE_HPP
@@ -0,0 +1,126 @@
+#ifndef MSD_ZIP_ZIP_EXECUTION_HPP
+#define MSD_ZIP_ZIP_EXECUTION_HPP
+
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "zip.hpp"
+
+namespace msd {
+
+namespace detail {
+
+/**
+ * @brief Enables a function only if the given type is an execution policy.
+ *
+ * @tparam ExecutionPolicy The type to be checked.
+ */
+template <typename ExecutionPolicy>
+using enable_if_execution_policy_t = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int>;
+
+}  // namespace detail
+
+/**
+ * @brief Applies a function to each element of a zipped sequence, according to an execution policy.
+ *
+ * If all zipped containers are random access, a parallel policy splits the zipped sequence into chunks processed by
+ * multiple threads. Otherwise, the standard library may execute the algorithm sequentially.
+ *
+ * @note With GCC, the parallel policies require linking with TBB (if TBB is available).
+ *
+ * @tparam ExecutionPolicy The type of the execution policy.
+ * @tparam Containers The types of the zipped containers.
+ * @tparam Function The type of the function.
+ * @param policy The execution policy to use (e.g. `std::execution::par_unseq`).
+ * @param zipped The zipped sequence.
+ * @param function The function to be applied to each tuple of elements.
+ */
+template <typename ExecutionPolicy, typename... Containers, typename Function,
+          detail::enable_if_execution_policy_t<ExecutionPolicy> = 0>
+void for_each(ExecutionPolicy&& policy, const zip<Containers...>& zipped, Function function)
+{
+    std::for_each(std::forward<ExecutionPolicy>(policy), zipped.begin(), zipped.end(), std::move(function));
+}
+
+/**
+ * @brief Transforms each element of a zipped sequence into an output range, according to an execution policy.
+ *
+ * @see for_each()
+ *
+ * @tparam ExecutionPolicy The type of the execution policy.
+ * @tparam Containers The types of the zipped containers.
+ * @tparam OutputIterator The type of the output iterator.
+ * @tparam Function The type of the function.
+ * @param policy The execution policy to use (e.g. `std::execution::par_unseq`).
+ * @param zipped The zipped sequence.
+ * @param output The beginning of the output range, which must hold at least `zipped.size()` elements.
+ * @param function The function transforming each tuple of elements.
+ * @return An iterator past the last transformed element.
+ */
+template <typename ExecutionPolicy, typename... Containers, typename OutputIterator, typename Function,
+          detail::enable_if_execution_policy_t<ExecutionPolicy> = 0>
+OutputIterator transform(ExecutionPolicy&& policy, const zip<Containers...>& zipped, OutputIterator output,
+                         Function function)
+{
+    return std::transform(std::forward<ExecutionPolicy>(policy), zipped.begin(), zipped.end(), output,
+                          std::move(function));
+}
+
+/**
+ * @brief Reduces the elements of a zipped sequence, according to an execution policy.
+ *
+ * The operation may be applied in any order and grouping, so it must be associative and commutative, and it must
+ * accept any combination of the initial value type and tuples of elements.
+ *
+ * @see for_each()
+ *
+ * @tparam ExecutionPolicy The type of the execution policy.
+ * @tparam Containers The types of the zipped containers.
+ * @tparam T The type of the result.
+ * @tparam BinaryOperation The type of the reduction operation.
+ * @param policy The execution policy to use (e.g. `std::execution::par_unseq`).
+ * @param zipped The zipped sequence.
+ * @param init The initial value of the reduction.
+ * @param operation The reduction operation.
+ * @return The result of the reduction.
+ */
+template <typename ExecutionPolicy, typename... Containers, typename T, typename BinaryOperation,
+          detail::enable_if_execution_policy_t<ExecutionPolicy> = 0>
+T reduce(ExecutionPolicy&& policy, const zip<Containers...>& zipped, T init, BinaryOperation operation)
+{
+    return std::reduce(std::forward<ExecutionPolicy>(policy), zipped.begin(), zipped.end(), std::move(init),
+                       std::move(operation));
+}
+
+/**
+ * @brief Transforms each element of a zipped sequence and reduces the results, according to an execution policy.
+ *
+ * @see reduce()
+ *
+ * @tparam ExecutionPolicy The type of the execution policy.
+ * @tparam Containers The types of the zipped containers.
+ * @tparam T The type of the result.
+ * @tparam BinaryOperation The type of the reduction operation.
+ * @tparam UnaryOperation The type of the transformation.
+ * @param policy The execution policy to use (e.g. `std::execution::par_unseq`).
+ * @param zipped The zipped sequence.
+ * @param init The initial value of the reduction.
+ * @param reduction The reduction operation, which must be associative and commutative.
+ * @param transformation The transformation applied to each tuple of elements.
+ * @return The result of the reduction.
+ */
+template <typename ExecutionPolicy, typename... Containers, typename T, typename BinaryOperation,
+          typename UnaryOperation, detail::enable_if_execution_policy_t<ExecutionPolicy> = 0>
+T transform_reduce(ExecutionPolicy&& policy, const zip<Containers...>& zipped, T init, BinaryOperation reduction,
+                   UnaryOperation transformation)
+{
+    return std::transform_reduce(std::forward<ExecutionPolicy>(policy), zipped.begin(), zipped.end(),
+                                 std::move(init), std::move(reduction), std::move(transformation));
+}
+
+}  // namespace msd
+
+#endif  // MSD_ZIP_ZIP_EXECUTION_HPP
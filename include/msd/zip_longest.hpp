@@ -0,0 +1,300 @@
+#ifndef MSD_ZIP_ZIP_LONGEST_HPP
+#define MSD_ZIP_ZIP_LONGEST_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "zip.hpp"
+
+namespace msd {
+
+namespace detail {
+
+/**
+ * @brief The type of the elements of a container.
+ *
+ * @tparam Container The type of the container.
+ */
+template <typename Container>
+using container_value_t = typename std::iterator_traits<iterator_t<std::remove_reference_t<Container>>>::value_type;
+
+/**
+ * @brief The type returned by dereferencing an iterator of a container.
+ *
+ * @tparam Container The type of the container.
+ */
+template <typename Container>
+using container_reference_t = typename std::iterator_traits<iterator_t<std::remove_reference_t<Container>>>::reference;
+
+/**
+ * @brief The type of an element of a `zip_longest` row: a reference to const if the iterators of the container return
+ * references, else a copy of the element (e.g. for `std::vector<bool>` or `msd::iota`, whose iterators return proxies
+ * or values).
+ *
+ * @tparam Container The type of the container.
+ */
+template <typename Container>
+using longest_element_t = std::conditional_t<std::is_lvalue_reference_v<container_reference_t<Container>>,
+                                             const container_value_t<Container>&, container_value_t<Container>>;
+
+}  // namespace detail
+
+/**
+ * @brief A view over multiple containers which stops at the longest one, instead of the shortest one as `msd::zip`.
+ *
+ * Past the end of a container, its column refers to a fill value stored in the view, so the shorter containers are
+ * not copied or resized. Rows are read-only: their elements are references to const, either to the elements of the
+ * containers or to the fill values. Containers whose iterators return proxies or values (e.g. `std::vector<bool>`,
+ * `msd::iota`) have their elements and fill values copied into the rows instead.
+ *
+ * @tparam Containers The types of the containers (`Container&&` for owned containers).
+ */
+template <typename... Containers>
+class zip_longest {
+    static_assert(sizeof...(Containers) > 1, "zip_longest requires at least 2 containers");
+
+   public:
+    /**
+     * @brief The fill values, one for each container.
+     */
+    using fill_type = std::tuple<detail::container_value_t<Containers>...>;
+
+    /**
+     * @brief Forward iterator over the rows of the containers, past the end of each container yielding its fill value.
+     */
+    class iterator {
+       public:
+        /**
+         * @brief The rows can be iterated multiple times.
+         */
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief The difference between two iterators.
+         */
+        using difference_type = std::ptrdiff_t;
+
+        /**
+         * @brief The copy of a row.
+         */
+        using value_type = fill_type;
+
+        /**
+         * @brief References to the elements of a row, or copies of them for containers without references.
+         */
+        using reference = zip_reference<detail::longest_element_t<Containers>...>;
+
+        /**
+         * @brief Rows are returned by value.
+         */
+        using pointer = void;
+
+        /**
+         * @brief Constructs an iterator from the current positions and the ends of the containers.
+         *
+         * @param positions The current positions.
+         * @param ends The ends of the containers.
+         * @param fills The fill values.
+         */
+        constexpr iterator(std::tuple<detail::iterator_t<std::remove_reference_t<Containers>>...> positions,
+                           std::tuple<detail::iterator_t<std::remove_reference_t<Containers>>...> ends,
+                           const fill_type* fills)
+            : positions_{positions}, ends_{ends}, fills_{fills}
+        {
+        }
+
+        /**
+         * @brief Returns references to the current elements, or to the fill values of the containers at their end.
+         *
+         * @return The current row.
+         */
+        constexpr reference operator*() const { return dereference(std::index_sequence_for<Containers...>{}); }
+
+        /**
+         * @brief Advances the containers which are not at their end.
+         *
+         * @return A reference to the updated iterator.
+         */
+        constexpr iterator& operator++()
+        {
+            increment(std::index_sequence_for<Containers...>{});
+            return *this;
+        }
+
+        /**
+         * @brief Advances the containers which are not at their end.
+         *
+         * @return A copy of the iterator before it was advanced.
+         */
+        constexpr iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /**
+         * @brief Checks if two iterators are equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if all positions are equal, `false` otherwise.
+         */
+        constexpr bool operator==(const iterator& other) const { return positions_ == other.positions_; }
+
+        /**
+         * @brief Checks if two iterators are not equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if any position differs, `false` otherwise.
+         */
+        constexpr bool operator!=(const iterator& other) const { return !(*this == other); }
+
+       private:
+        std::tuple<detail::iterator_t<std::remove_reference_t<Containers>>...> positions_;
+        std::tuple<detail::iterator_t<std::remove_reference_t<Containers>>...> ends_;
+        const fill_type* fills_;
+
+        /**
+         * @brief Returns the current elements, or the fill values of the containers at their end.
+         *
+         * @tparam I Indices used to unpack the tuples of iterators.
+         * @return The current row.
+         */
+        template <std::size_t... I>
+        constexpr reference dereference(std::index_sequence<I...>) const
+        {
+            return reference{element<I, detail::longest_element_t<Containers>>()...};
+        }
+
+        /**
+         * @brief Returns the current element of a container, or its fill value at the end.
+         *
+         * @tparam I The index of the container.
+         * @tparam Element The type of the element in the row.
+         * @return A reference to the element, or a copy of it.
+         */
+        template <std::size_t I, typename Element>
+        constexpr Element element() const
+        {
+            if (std::get<I>(positions_) == std::get<I>(ends_)) {
+                return std::get<I>(*fills_);
+            }
+            return *std::get<I>(positions_);
+        }
+
+        /**
+         * @brief Advances the containers which are not at their end.
+         *
+         * @tparam I Indices used to unpack the tuples of iterators.
+         */
+        template <std::size_t... I>
+        constexpr void increment(std::index_sequence<I...>)
+        {
+            ((std::get<I>(positions_) == std::get<I>(ends_) ? void() : void(++std::get<I>(positions_))), ...);
+        }
+    };
+
+    /**
+     * @brief Constant iterator over the rows; rows are always read-only.
+     */
+    using const_iterator = iterator;
+
+    /**
+     * @brief Constructs a view from the fill values and the containers.
+     *
+     * @param fills The fill values, one for each container.
+     * @param containers The containers. Rvalue containers are moved into the view.
+     */
+    constexpr explicit zip_longest(fill_type fills, detail::zip_parameter_t<Containers>... containers)
+        : containers_{std::forward<detail::zip_parameter_t<Containers>>(containers)...}, fills_{std::move(fills)}
+    {
+    }
+
+    /**
+     * @brief Returns an iterator to the first row.
+     *
+     * @return An iterator to the beginning of the view.
+     */
+    constexpr iterator begin() const { return make_iterator(kBegin, std::index_sequence_for<Containers...>{}); }
+
+    /**
+     * @brief Returns an iterator past the last row, where all containers are at their end.
+     *
+     * @return An iterator to the end of the view.
+     */
+    constexpr iterator end() const { return make_iterator(kEnd, std::index_sequence_for<Containers...>{}); }
+
+    /**
+     * @brief Returns the number of rows, which is the size of the longest container.
+     *
+     * @return The number of rows.
+     */
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        return size_impl(std::index_sequence_for<Containers...>{});
+    }
+
+    /**
+     * @brief Checks if all containers are empty.
+     *
+     * @return `true` if the view is empty, `false` otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const { return begin() == end(); }
+
+    /**
+     * @brief Returns the fill values.
+     *
+     * @return The fill values.
+     */
+    constexpr const fill_type& fills() const noexcept { return fills_; }
+
+   private:
+    static constexpr bool kBegin = true;
+    static constexpr bool kEnd = false;
+
+    std::tuple<detail::zip_storage_t<Containers>...> containers_;
+    fill_type fills_;
+
+    /**
+     * @brief Creates an iterator at the beginning or at the end of all containers.
+     *
+     * @tparam I Indices used to unpack the tuple of containers.
+     * @param begin `kBegin` or `kEnd`.
+     * @return The iterator.
+     */
+    template <std::size_t... I>
+    constexpr iterator make_iterator(const bool begin, std::index_sequence<I...>) const
+    {
+        const auto ends = std::make_tuple(std::end(detail::unwrap(std::get<I>(containers_)))...);
+        if (begin) {
+            return iterator{std::make_tuple(std::begin(detail::unwrap(std::get<I>(containers_)))...), ends, &fills_};
+        }
+        return iterator{ends, ends, &fills_};
+    }
+
+    /**
+     * @brief Determines the number of rows as the size of the largest container.
+     *
+     * @tparam I Indices used to unpack the tuple of containers.
+     * @return The number of rows.
+     */
+    template <std::size_t... I>
+    constexpr std::size_t size_impl(std::index_sequence<I...>) const
+    {
+        return std::max({detail::container_size(detail::unwrap(std::get<I>(containers_)))...});
+    }
+};
+
+/**
+ * @brief Deduces the types of the containers of a `zip_longest`: lvalues are referenced, rvalues are owned.
+ */
+template <typename Fills, typename... Containers>
+zip_longest(Fills, Containers&&...) -> zip_longest<detail::zip_container_t<Containers>...>;
+
+}  // namespace msd
+
+#endif  // MSD_ZIP_ZIP_LONGEST_HPP
@@ -0,0 +1,417 @@
+#ifndef MSD_ZIP_ZIP_NUMERIC_HPP
+#define MSD_ZIP_ZIP_NUMERIC_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "zip.hpp"
+
+/**
+ * @brief Hand-vectorized kernels are available for x86 with GCC and Clang, unless `MSD_ZIP_NO_SIMD` is defined.
+ */
+#if !defined(MSD_ZIP_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MSD_ZIP_SIMD 1
+#include <immintrin.h>
+#else
+#define MSD_ZIP_SIMD 0
+#endif
+
+namespace msd {
+
+/**
+ * @brief The instruction sets used by the vectorized kernels, from the least to the most capable.
+ */
+enum class simd_isa { kScalar, kSse2, kAvx2, kAvx512 };
+
+namespace detail {
+
+/**
+ * @brief Computes the dot product of two arrays without explicit vector instructions.
+ *
+ * Uses independent accumulators so consecutive additions don't wait for each other.
+ *
+ * @tparam T The type of the elements.
+ * @param lhs The first array.
+ * @param rhs The second array.
+ * @param size The number of elements of each array.
+ * @return The sum of the products of the elements.
+ */
+template <typename T>
+T dot_scalar(const T* lhs, const T* rhs, const std::size_t size) noexcept
+{
+    T sums[4] = {};  // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    std::size_t i = 0;
+
+    for (; i + 4 <= size; i += 4) {
+        sums[0] += lhs[i] * rhs[i];
+        sums[1] += lhs[i + 1] * rhs[i + 1];
+        sums[2] += lhs[i + 2] * rhs[i + 2];
+        sums[3] += lhs[i + 3] * rhs[i + 3];
+    }
+    for (; i < size; ++i) {
+        sums[0] += lhs[i] * rhs[i];
+    }
+
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+#if MSD_ZIP_SIMD
+
+/**
+ * @brief Sums the lanes of a vector register stored into an array.
+ *
+ * @tparam T The type of the lanes.
+ * @tparam N The number of lanes.
+ * @param lanes The stored lanes.
+ * @return The sum of the lanes.
+ */
+template <typename T, std::size_t N>
+T sum_lanes(const T (&lanes)[N]) noexcept  // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays)
+{
+    T sum{};
+    for (const auto lane : lanes) {
+        sum += lane;
+    }
+    return sum;
+}
+
+/**
+ * @brief Computes the dot product of two arrays of floats with SSE2.
+ *
+ * @param lhs The first array.
+ * @param rhs The second array.
+ * @param size The number of elements of each array.
+ * @return The sum of the products of the elements.
+ */
+__attribute__((target("sse2"))) inline float dot_sse2(const float* lhs, const float* rhs,
+                                                      const std::size_t size) noexcept
+{
+    __m128 first = _mm_setzero_ps();
+    __m128 second = _mm_setzero_ps();
+    std::size_t i = 0;
+
+    for (; i + 8 <= size; i += 8) {
+        first = _mm_add_ps(first, _mm_mul_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i)));
+        second = _mm_add_ps(second, _mm_mul_ps(_mm_loadu_ps(lhs + i + 4), _mm_loadu_ps(rhs + i + 4)));
+    }
+
+    alignas(16) float lanes[4];  // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    _mm_store_ps(lanes, _mm_add_ps(first, second));
+    return sum_lanes(lanes) + dot_scalar(lhs + i, rhs + i, size - i);
+}
+
+/**
+ * @brief Computes the dot product of two arrays of doubles with SSE2.
+ *
+ * @param lhs The first array.
+ * @param rhs The second array.
+ * @param size The number of elements of each array.
+ * @return The sum of the products of the elements.
+ */
+__attribute__((target("sse2"))) inline double dot_sse2(const double* lhs, const double* rhs,
+                                                       const std::size_t size) noexcept
+{
+    __m128d first = _mm_setzero_pd();
+    __m128d second = _mm_setzero_pd();
+    std::size_t i = 0;
+
+    for (; i + 4 <= size; i += 4) {
+        first = _mm_add_pd(first, _mm_mul_pd(_mm_loadu_pd(lhs + i), _mm_loadu_pd(rhs + i)));
+        second = _mm_add_pd(second, _mm_mul_pd(_mm_loadu_pd(lhs + i + 2), _mm_loadu_pd(rhs + i + 2)));
+    }
+
+    alignas(16) double lanes[2];  // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    _mm_store_pd(lanes, _mm_add_pd(first, second));
+    return sum_lanes(lanes) + dot_scalar(lhs + i, rhs + i, size - i);
+}
+
+/**
+ * @brief Computes the dot product of two arrays of floats with AVX2 and FMA.
+ *
+ * @param lhs The first array.
+ * @param rhs The second array.
+ * @param size The number of elements of each array.
+ * @return The sum of the products of the elements.
+ */
+__attribute__((target("avx2,fma"))) inline float dot_avx2(const float* lhs, const float* rhs,
+                                                          const std::size_t size) noexcept
+{
+    __m256 first = _mm256_setzero_ps();
+    __m256 second = _mm256_setzero_ps();
+    std::size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        first = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i), first);
+        second = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + i + 8), _mm256_loadu_ps(rhs + i + 8), second);
+    }
+
+    const __m256 sum = _mm256_add_ps(first, second);
+    const __m128 half = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    alignas(16) float lanes[4];  // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    _mm_store_ps(lanes, half);
+    return sum_lanes(lanes) + dot_scalar(lhs + i, rhs + i, size - i);
+}
+
+/**
+ * @brief Computes the dot product of two arrays of doubles with AVX2 and FMA.
+ *
+ * @param lhs The first array.
+ * @param rhs The second array.
+ * @param size The number of elements of each array.
+ * @return The sum of the products of the elements.
+ */
+__attribute__((target("avx2,fma"))) inline double dot_avx2(const double* lhs, const double* rhs,
+                                                           const std::size_t size) noexcept
+{
+    __m256d first = _mm256_setzero_pd();
+    __m256d second = _mm256_setzero_pd();
+    std::size_t i = 0;
+
+    for (; i + 8 <= size; i += 8) {
+        first = _mm256_fmadd_pd(_mm256_loadu_pd(lhs + i), _mm256_loadu_pd(rhs + i), first);
+        second = _mm256_fmadd_pd(_mm256_loadu_pd(lhs + i + 4), _mm256_loadu_pd(rhs + i + 4), second);
+    }
+
+    const __m256d sum = _mm256_add_pd(first, second);
+    const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+    alignas(16) double lanes[2];  // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    _mm_store_pd(lanes, half);
+    return sum_lanes(lanes) + dot_scalar(lhs + i, rhs + i, size - i);
+}
+
+/**
+ * @brief Computes the dot product of two arrays of floats with AVX-512.
+ *
+ * @param lhs The first array.
+ * @param rhs The second array.
+ * @param size The number of elements of each array.
+ * @return The sum of the products of the elements.
+ */
+__attribute__((target("avx512f"))) inline float dot_avx512(const float* lhs, const float* rhs,
+                                                           const std::size_t size) noexcept
+{
+    __m512 first = _mm512_setzero_ps();
+    __m512 second = _mm512_setzero_ps();
+    std::size_t i = 0;
+
+    for (; i + 32 <= size; i += 32) {
+        first = _mm512_fmadd_ps(_mm512_loadu_ps(lhs + i), _mm512_loadu_ps(rhs + i), first);
+        second = _mm512_fmadd_ps(_mm512_loadu_ps(lhs + i + 16), _mm512_loadu_ps(rhs + i + 16), second);
+    }
+
+    // Stored and summed in scalar code, as GCC warns about uninitialized values in _mm512_reduce_add_ps.
+    alignas(64) float lanes[16];  // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    _mm512_store_ps(lanes, _mm512_add_ps(first, second));
+    return sum_lanes(lanes) + dot_scalar(lhs + i, rhs + i, size - i);
+}
+
+/**
+ * @brief Computes the dot product of two arrays of doubles with AVX-512.
+ *
+ * @param lhs The first array.
+ * @param rhs The second array.
+ * @param size The number of elements of each array.
+ * @return The sum of the products of the elements.
+ */
+__attribute__((target("avx512f"))) inline double dot_avx512(const double* lhs, const double* rhs,
+                                                            const std::size_t size) noexcept
+{
+    __m512d first = _mm512_setzero_pd();
+    __m512d second = _mm512_setzero_pd();
+    std::size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        first = _mm512_fmadd_pd(_mm512_loadu_pd(lhs + i), _mm512_loadu_pd(rhs + i), first);
+        second = _mm512_fmadd_pd(_mm512_loadu_pd(lhs + i + 8), _mm512_loadu_pd(rhs + i + 8), second);
+    }
+
+    alignas(64) double lanes[8];  // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    _mm512_store_pd(lanes, _mm512_add_pd(first, second));
+    return sum_lanes(lanes) + dot_scalar(lhs + i, rhs + i, size - i);
+}
+
+/**
+ * @brief Detects the most capable instruction set supported by the CPU.
+ *
+ * @return The detected instruction set.
+ */
+inline simd_isa detect_simd_isa() noexcept
+{
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) {
+        return simd_isa::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return simd_isa::kAvx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return simd_isa::kSse2;
+    }
+    return simd_isa::kScalar;
+}
+
+#endif
+
+/**
+ * @brief Computes the dot product of two arrays with the given instruction set.
+ *
+ * @tparam T The type of the elements (`float` or `double`).
+ * @param isa The instruction set, which must be supported by the CPU.
+ * @param lhs The first array.
+ * @param rhs The second array.
+ * @param size The number of elements of each array.
+ * @return The sum of the products of the elements.
+ */
+template <typename T>
+T dot(const simd_isa isa, const T* lhs, const T* rhs, const std::size_t size) noexcept
+{
+#if MSD_ZIP_SIMD
+    switch (isa) {
+        case simd_isa::kAvx512:
+            return dot_avx512(lhs, rhs, size);
+        case simd_isa::kAvx2:
+            return dot_avx2(lhs, rhs, size);
+        case simd_isa::kSse2:
+            return dot_sse2(lhs, rhs, size);
+        case simd_isa::kScalar:
+            break;
+    }
+#else
+    static_cast<void>(isa);
+#endif
+    return dot_scalar(lhs, rhs, size);
+}
+
+/**
+ * @brief Checks if a zip can be processed by the vectorized kernels: two contiguous columns of the same floating point
+ * type.
+ *
+ * @tparam Iterator The type of the iterator of the zip.
+ */
+template <typename Iterator>
+class is_simd_zip : public std::false_type {};
+
+/**
+ * @brief Checks if a zip can be processed by the vectorized kernels: two contiguous columns of the same floating point
+ * type.
+ *
+ * @tparam L The type of the elements of the first column.
+ * @tparam R The type of the elements of the second column.
+ */
+template <typename L, typename R>
+class is_simd_zip<offset_zip_iterator<L*, R*>>
+    : public std::bool_constant<std::is_same_v<std::remove_cv_t<L>, std::remove_cv_t<R>> &&
+                                (std::is_same_v<std::remove_cv_t<L>, float> ||
+                                 std::is_same_v<std::remove_cv_t<L>, double>)> {};
+
+}  // namespace detail
+
+/**
+ * @brief Returns the instruction set used by the vectorized kernels, detected once at runtime.
+ *
+ * @return The most capable instruction set supported by both the CPU and the library, `simd_isa::kScalar` if
+ * vectorized kernels are not available (non-x86 targets, other compilers or `MSD_ZIP_NO_SIMD` defined).
+ */
+inline simd_isa supported_simd_isa() noexcept
+{
+#if MSD_ZIP_SIMD
+    static const simd_isa isa = detail::detect_simd_isa();
+    return isa;
+#else
+    return simd_isa::kScalar;
+#endif
+}
+
+/**
+ * @brief Folds the rows of a zipped sequence in order: `init = operation(init, row)` for each row.
+ *
+ * @tparam Containers The types of the zipped containers.
+ * @tparam T The type of the result.
+ * @tparam BinaryOperation The type of the operation.
+ * @param zipped The zipped sequence.
+ * @param init The initial value.
+ * @param operation The operation receiving the accumulated value and a row (a tuple of references).
+ * @return The accumulated value.
+ */
+template <typename... Containers, typename T, typename BinaryOperation>
+T zip_reduce(const zip<Containers...>& zipped, T init, BinaryOperation operation)
+{
+    for (auto&& row : zipped) {
+        init = operation(std::move(init), row);
+    }
+    return init;
+}
+
+/**
+ * @brief Transforms the elements of each row of a zipped sequence and reduces the results.
+ *
+ * The transformation receives the elements of a row as separate arguments. For a zip of two contiguous `float` or
+ * `double` columns reduced with `std::plus<>` and transformed with `std::multiplies<>` (a dot product) into a result of
+ * the type of the elements, the result is computed with vectorized kernels selected at runtime (SSE2, AVX2 or
+ * AVX-512). As with `std::transform_reduce`, the reduction may then be applied in any order, so floating point results
+ * may differ slightly from a sequential sum. Results of other types (e.g. a `double` sum of `float` columns) are
+ * accumulated row by row in the type of the result.
+ *
+ * @tparam Containers The types of the zipped containers.
+ * @tparam T The type of the result.
+ * @tparam Reduction The type of the reduction.
+ * @tparam Transformation The type of the transformation.
+ * @param zipped The zipped sequence.
+ * @param init The initial value.
+ * @param reduction The reduction, which must be associative and commutative.
+ * @param transformation The transformation of the elements of a row.
+ * @return The result of the reduction.
+ */
+template <typename... Containers, typename T, typename Reduction, typename Transformation>
+T zip_transform_reduce(const zip<Containers...>& zipped, T init, Reduction reduction, Transformation transformation)
+{
+    using iterator = typename zip<Containers...>::iterator;
+
+    if constexpr (detail::is_simd_zip<iterator>::value && std::is_same_v<Reduction, std::plus<>> &&
+                  std::is_same_v<Transformation, std::multiplies<>> &&
+                  std::is_same_v<T, std::tuple_element_t<0, typename std::iterator_traits<iterator>::value_type>>) {
+        const auto size = zipped.size();
+        if (size == 0) {
+            return init;
+        }
+
+        const auto [lhs, rhs] = *zipped.begin();
+        return reduction(std::move(init),
+                         detail::dot(supported_simd_isa(), std::addressof(lhs), std::addressof(rhs), size));
+    }
+    else {
+        // As with std::transform_reduce, each partial result is converted to the type of the result.
+        for (auto&& row : zipped) {
+            init = static_cast<T>(reduction(std::move(init), std::apply(transformation, row)));
+        }
+        return init;
+    }
+}
+
+/**
+ * @brief Computes the dot product of two zipped columns: the sum of the products of their elements.
+ *
+ * @see zip_transform_reduce()
+ *
+ * @tparam First The type of the first container.
+ * @tparam Second The type of the second container.
+ * @tparam T The type of the result.
+ * @param zipped The zipped columns.
+ * @param init The initial value.
+ * @return The initial value plus the dot product.
+ */
+template <typename First, typename Second, typename T>
+T dot(const zip<First, Second>& zipped, T init)
+{
+    return zip_transform_reduce(zipped, std::move(init), std::plus<>{}, std::multiplies<>{});
+}
+
+}  // namespace msd
+
+#endif  // MSD_ZIP_ZIP_NUMERIC_HPP
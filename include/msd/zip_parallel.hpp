@@ -0,0 +1,547 @@
+#ifndef MSD_ZIP_ZIP_PARALLEL_HPP
+#define MSD_ZIP_ZIP_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "zip.hpp"
+
+namespace msd {
+
+/**
+ * @brief A fixed size pool of threads, each with its own queue of tasks. Idle threads steal tasks from the others.
+ *
+ * Tasks submitted by a worker go to the back of its own queue and are run from the back (newest first). Idle workers
+ * steal from the front of other queues, taking the oldest, usually largest, tasks.
+ */
+class thread_pool {
+   public:
+    /**
+     * @brief The type of the tasks.
+     */
+    using task = std::function<void()>;
+
+    /**
+     * @brief Starts the threads.
+     *
+     * @param threads The number of threads. If zero, the number of concurrent threads supported by the hardware.
+     */
+    explicit thread_pool(std::size_t threads = 0)
+        : queues_(threads == 0 ? std::max<std::size_t>(1, std::thread::hardware_concurrency()) : threads)
+    {
+        workers_.reserve(queues_.size());
+        for (std::size_t i = 0; i < queues_.size(); ++i) {
+            workers_.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+    thread_pool(thread_pool&&) = delete;
+    thread_pool& operator=(thread_pool&&) = delete;
+
+    /**
+     * @brief Stops the threads after all submitted tasks are run.
+     */
+    ~thread_pool()
+    {
+        {
+            std::lock_guard lock{mutex_};
+            stopping_ = true;
+        }
+        wake_.notify_all();
+
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Returns the number of threads.
+     *
+     * @return The number of threads.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return workers_.size(); }
+
+    /**
+     * @brief Submits a task. Tasks must not throw.
+     *
+     * @param function The task.
+     * @throws std::bad_alloc If the task can't be queued; it's not submitted.
+     */
+    void execute(task function)
+    {
+        // Counted before being queued, so the count is never lower than the number of queued tasks.
+        {
+            std::lock_guard lock{mutex_};
+            ++pending_;
+        }
+
+        const auto index = current_index();
+        auto& target = queues_[index < queues_.size() ? index : next_.fetch_add(1) % queues_.size()];
+        try {
+            std::lock_guard lock{target.mutex};
+            target.tasks.push_back(std::move(function));
+        }
+        catch (...) {
+            std::lock_guard lock{mutex_};
+            --pending_;
+            throw;
+        }
+        wake_.notify_one();
+    }
+
+    /**
+     * @brief Runs one submitted task on the calling thread, if any is queued.
+     *
+     * Allows a thread waiting for tasks to finish to help instead of blocking.
+     *
+     * @return True if a task was run.
+     */
+    bool run_pending_task()
+    {
+        const auto index = current_index();
+        auto function = take(index < queues_.size() ? index : 0);
+        if (!function) {
+            return false;
+        }
+
+        {
+            std::lock_guard lock{mutex_};
+            --pending_;
+        }
+        function();
+        return true;
+    }
+
+   private:
+    /**
+     * @brief The queue of a thread.
+     */
+    class task_queue {
+       public:
+        std::mutex mutex;
+        std::deque<task> tasks;
+    };
+
+    std::vector<task_queue> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<std::size_t> next_{0};
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::size_t pending_{0};
+    bool stopping_{false};
+
+    /**
+     * @brief Returns the index of the calling thread in its pool, or a value past the queues if it's not a worker of
+     * this pool.
+     *
+     * @return The index of the calling thread.
+     */
+    std::size_t current_index() const noexcept
+    {
+        return current_pool() == this ? current_worker() : static_cast<std::size_t>(-1);
+    }
+
+    static const thread_pool*& current_pool() noexcept
+    {
+        thread_local const thread_pool* pool = nullptr;
+        return pool;
+    }
+
+    static std::size_t& current_worker() noexcept
+    {
+        thread_local std::size_t worker = 0;
+        return worker;
+    }
+
+    /**
+     * @brief Takes the newest task of the given queue or, if empty, the oldest task of another queue.
+     *
+     * @param index The index of the preferred queue.
+     * @return The task, or an empty function if all queues are empty.
+     */
+    task take(const std::size_t index)
+    {
+        {
+            auto& own = queues_[index];
+            std::lock_guard lock{own.mutex};
+            if (!own.tasks.empty()) {
+                auto function = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                return function;
+            }
+        }
+
+        for (std::size_t i = 1; i < queues_.size(); ++i) {
+            auto& other = queues_[(index + i) % queues_.size()];
+            std::lock_guard lock{other.mutex};
+            if (!other.tasks.empty()) {
+                auto function = std::move(other.tasks.front());
+                other.tasks.pop_front();
+                return function;
+            }
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Runs tasks until the pool is stopped and no tasks are left.
+     *
+     * @param index The index of the thread.
+     */
+    void work(const std::size_t index)
+    {
+        current_pool() = this;
+        current_worker() = index;
+
+        while (true) {
+            {
+                std::unique_lock lock{mutex_};
+                wake_.wait(lock, [this] { return pending_ > 0 || stopping_; });
+                if (pending_ == 0 && stopping_) {
+                    return;
+                }
+            }
+
+            run_pending_task();
+        }
+    }
+};
+
+/**
+ * @brief Options of parallel_for().
+ */
+class parallel_options {
+   public:
+    /**
+     * @brief The number of threads of the pool created for a call. If zero, a pool shared by all calls is used, with
+     * a thread for each hardware thread. If an executor is given, it's only used to choose the default grain, when the
+     * executor doesn't tell its number of threads.
+     */
+    std::size_t threads{0};
+
+    /**
+     * @brief The maximum number of rows processed by a task without splitting them further. If zero, it's chosen from
+     * the size of the zip and the number of threads: the `size()` of the executor if it has one (like thread_pool),
+     * else the threads of the options, else the number of hardware threads.
+     */
+    std::size_t grain{0};
+};
+
+namespace detail {
+
+/**
+ * @brief Checks if an executor tells its number of threads with a `size()` member function.
+ *
+ * @tparam Executor The type of the executor to be checked.
+ */
+template <typename Executor, typename = void>
+class has_executor_size : public std::false_type {};
+
+/**
+ * @brief Checks if an executor tells its number of threads with a `size()` member function.
+ *
+ * @tparam Executor The type of the executor to be checked.
+ */
+template <typename Executor>
+class has_executor_size<Executor, std::void_t<decltype(std::declval<const Executor&>().size())>>
+    : public std::true_type {};
+
+/**
+ * @brief Returns the number of threads running the tasks of a parallel_for() call: the size of the executor if it has
+ * one, else the threads of the options, else the number of hardware threads.
+ *
+ * @tparam Executor The type of the executor.
+ * @param executor The executor.
+ * @param options The options of the call.
+ * @return The number of threads, at least one.
+ */
+template <typename Executor>
+std::size_t executor_threads(const Executor& executor, const parallel_options& options)
+{
+    if constexpr (has_executor_size<Executor>::value) {
+        const auto threads = static_cast<std::size_t>(executor.size());
+        if (threads > 0) {
+            return threads;
+        }
+    }
+    else {
+        static_cast<void>(executor);
+    }
+
+    if (options.threads > 0) {
+        return options.threads;
+    }
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Returns the thread pool shared by parallel_for() calls without an executor.
+ *
+ * @return The shared pool.
+ */
+inline thread_pool& default_thread_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+/**
+ * @brief The state of a parallel_for() call, shared by its tasks.
+ *
+ * @tparam Iterator The type of the zip iterator.
+ * @tparam Function The type of the function applied to each row.
+ */
+template <typename Iterator, typename Function>
+class parallel_for_state {
+   public:
+    /**
+     * @brief Initializes the state.
+     *
+     * @param begin The first row.
+     * @param size The number of rows.
+     * @param grain The maximum number of rows processed without splitting.
+     * @param function The function applied to each row.
+     */
+    parallel_for_state(Iterator begin, const std::size_t size, const std::size_t grain, Function& function)
+        : begin_{begin}, remaining_{size}, grain_{grain}, function_{function}
+    {
+    }
+
+    /**
+     * @brief Processes a range of rows, splitting it in halves while it's larger than the grain. The upper halves are
+     * submitted as new tasks, so idle threads steal the largest pending ranges. If a half can't be submitted (the
+     * executor throws), the rest of the range is processed by this task.
+     *
+     * @tparam Executor The type of the executor.
+     * @param executor The executor receiving the split halves.
+     * @param first The offset of the first row.
+     * @param last The offset past the last row.
+     */
+    template <typename Executor>
+    void run(Executor& executor, std::size_t first, std::size_t last)
+    {
+        while (last - first > grain_) {
+            const auto middle = first + (last - first) / 2;
+            try {
+                executor.execute([this, &executor, middle, last] { run(executor, middle, last); });
+            }
+            catch (...) {
+                break;
+            }
+            last = middle;
+        }
+
+        if (!failed_.load(std::memory_order_relaxed)) {
+            try {
+                auto it = begin_ + static_cast<std::ptrdiff_t>(first);
+                for (auto offset = first; offset != last; ++offset, ++it) {
+                    function_(*it);
+                }
+            }
+            catch (...) {
+                fail(std::current_exception());
+            }
+        }
+
+        finish(last - first);
+    }
+
+    /**
+     * @brief Checks if all rows were processed.
+     *
+     * @return True if all rows were processed.
+     */
+    [[nodiscard]] bool done() const noexcept { return remaining_.load(std::memory_order_acquire) == 0; }
+
+    /**
+     * @brief Blocks until all rows are processed, or a while, whichever comes first.
+     */
+    void wait_for_done()
+    {
+        std::unique_lock lock{mutex_};
+        done_.wait_for(lock, std::chrono::milliseconds{1}, [this] { return done(); });
+    }
+
+    /**
+     * @brief Blocks until all rows are processed.
+     */
+    void wait()
+    {
+        std::unique_lock lock{mutex_};
+        done_.wait(lock, [this] { return done(); });
+    }
+
+    /**
+     * @brief Rethrows the first exception thrown by the function, if any.
+     */
+    void rethrow() const
+    {
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+    }
+
+   private:
+    Iterator begin_;
+    std::atomic<std::size_t> remaining_;
+    std::size_t grain_;
+    Function& function_;
+
+    std::mutex mutex_;
+    std::condition_variable done_;
+    std::atomic<bool> failed_{false};
+    std::exception_ptr exception_;
+
+    void fail(std::exception_ptr exception)
+    {
+        std::lock_guard lock{mutex_};
+        if (!exception_) {
+            exception_ = std::move(exception);
+        }
+        failed_.store(true, std::memory_order_relaxed);
+    }
+
+    // Counts down under the lock, so a waiter can't destroy the state before the last task releases it.
+    void finish(const std::size_t rows)
+    {
+        std::lock_guard lock{mutex_};
+        if (remaining_.fetch_sub(rows, std::memory_order_acq_rel) == rows) {
+            done_.notify_all();
+        }
+    }
+};
+
+/**
+ * @brief Waits for a parallel_for() call, running pending tasks of the pool on the calling thread meanwhile.
+ *
+ * Helping avoids deadlocks when parallel_for() is called from a task of the same pool.
+ *
+ * @tparam State The type of the state of the call.
+ * @param pool The pool running the tasks.
+ * @param state The state of the call.
+ */
+template <typename State>
+void wait(thread_pool& pool, State& state)
+{
+    while (!state.done()) {
+        if (!pool.run_pending_task()) {
+            state.wait_for_done();
+        }
+    }
+    state.wait();
+}
+
+/**
+ * @brief Waits for a parallel_for() call running on a user-supplied executor.
+ *
+ * @tparam Executor The type of the executor.
+ * @tparam State The type of the state of the call.
+ * @param state The state of the call.
+ */
+template <typename Executor, typename State>
+void wait(Executor&, State& state)
+{
+    state.wait();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Applies a function to each row of a zipped sequence, on the threads of an executor.
+ *
+ * The zip is split recursively in halves down to the grain of the options, and the halves are submitted to the
+ * executor as separate tasks, so rows with uneven costs are balanced by threads taking the pending halves. If the
+ * zipped containers are not all random access, or the zip is not larger than the grain, the rows are processed
+ * sequentially on the calling thread.
+ *
+ * The first exception thrown by the function is rethrown after all tasks finish. Rows not yet processed when the
+ * exception is thrown are skipped.
+ *
+ * @tparam Executor The type of the executor, which must have an `execute(std::function<void()>)` member function
+ * (like thread_pool).
+ * @tparam Containers The types of the zipped containers.
+ * @tparam Function The type of the function.
+ * @param executor The executor running the tasks. It must outlive the call.
+ * @param zipped The zipped sequence.
+ * @param function The function applied to each row. It's called concurrently.
+ * @param options The options.
+ */
+template <typename Executor, typename... Containers, typename Function>
+void parallel_for(Executor& executor, const zip<Containers...>& zipped, Function function,
+                  const parallel_options& options = {})
+{
+    using iterator = typename zip<Containers...>::iterator;
+    constexpr bool is_random_access =
+        std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<iterator>::iterator_category>;
+
+    if constexpr (!is_random_access) {
+        for (auto&& row : zipped) {
+            function(row);
+        }
+    }
+    else {
+        const auto size = zipped.size();
+        auto grain = options.grain;
+        if (grain == 0) {
+            constexpr std::size_t kTasksPerThread = 32;
+            const std::size_t threads = detail::executor_threads(executor, options);
+            grain = std::max<std::size_t>(1, size / (threads * kTasksPerThread));
+        }
+
+        if (size <= grain) {
+            for (auto&& row : zipped) {
+                function(row);
+            }
+            return;
+        }
+
+        detail::parallel_for_state<iterator, Function> state{zipped.begin(), size, grain, function};
+        executor.execute([&state, &executor, size] { state.run(executor, 0, size); });
+        detail::wait(executor, state);
+        state.rethrow();
+    }
+}
+
+/**
+ * @brief Applies a function to each row of a zipped sequence, on a built-in work-stealing thread pool.
+ *
+ * @see parallel_for(Executor&, const zip<Containers...>&, Function, const parallel_options&)
+ *
+ * @tparam Containers The types of the zipped containers.
+ * @tparam Function The type of the function.
+ * @param zipped The zipped sequence.
+ * @param function The function applied to each row. It's called concurrently.
+ * @param options The options. With a non-zero number of threads, a pool is created for the call.
+ */
+template <typename... Containers, typename Function>
+void parallel_for(const zip<Containers...>& zipped, Function function, const parallel_options& options = {})
+{
+    if (options.threads == 0) {
+        parallel_for(detail::default_thread_pool(), zipped, std::move(function), options);
+    }
+    else {
+        thread_pool pool{options.threads};
+        parallel_for(pool, zipped, std::move(function), options);
+    }
+}
+
+}  // namespace msd
+
+#endif  // MSD_ZIP_ZIP_PARALLEL_HPP
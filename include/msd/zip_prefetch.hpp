@@ -0,0 +1,303 @@
+#ifndef MSD_ZIP_ZIP_PREFETCH_HPP
+#define MSD_ZIP_ZIP_PREFETCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "zip.hpp"
+
+namespace msd {
+
+namespace detail {
+
+/**
+ * @brief Hints the CPU to load the memory at an address into the cache, without waiting for it.
+ *
+ * Does nothing on compilers without `__builtin_prefetch`.
+ *
+ * @param address The address to be loaded.
+ */
+inline void prefetch([[maybe_unused]] const void* address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief A view over multiple containers, like `msd::zip`, which prefetches the elements of each container a number of
+ * rows ahead of the current one.
+ *
+ * Meant for node based containers (`std::list`, `std::map`, `std::set`), whose nodes are scattered in memory, so each
+ * step of a zip waits for a cache miss in every container. Each iterator keeps a lookahead iterator for each container
+ * and prefetches its element, so the misses of the upcoming rows overlap with the work on the current one.
+ *
+ * @tparam Containers The types of the containers (`Container&&` for owned containers).
+ */
+template <typename... Containers>
+class prefetching_zip {
+    static_assert(sizeof...(Containers) > 1, "prefetching_zip requires at least 2 containers");
+
+    /**
+     * @brief The iterators of the containers.
+     */
+    using iterators = std::tuple<detail::iterator_t<std::remove_reference_t<Containers>>...>;
+
+   public:
+    /**
+     * @brief Forward iterator over the rows of the containers, prefetching the elements of the upcoming rows.
+     */
+    class iterator {
+       public:
+        /**
+         * @brief The type of the iterator over the current rows.
+         */
+        using base_iterator = zip_iterator<detail::iterator_t<std::remove_reference_t<Containers>>...>;
+
+        /**
+         * @brief The lookahead iterators can only move forward.
+         */
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief The difference between two iterators.
+         */
+        using difference_type = typename base_iterator::difference_type;
+
+        /**
+         * @brief A tuple of values from each container.
+         */
+        using value_type = typename base_iterator::value_type;
+
+        /**
+         * @brief A tuple of references from each container.
+         */
+        using reference = typename base_iterator::reference;
+
+        /**
+         * @brief Rows are returned by value.
+         */
+        using pointer = void;
+
+        /**
+         * @brief Constructs an iterator from the current rows, the lookahead positions and the ends of the containers.
+         *
+         * @param current The current rows.
+         * @param ahead The positions of the prefetched elements.
+         * @param ends The ends of the containers.
+         */
+        constexpr iterator(base_iterator current, iterators ahead, iterators ends)
+            : current_{current}, ahead_{ahead}, ends_{ends}
+        {
+        }
+
+        /**
+         * @brief Returns the current row.
+         *
+         * @return References to the current elements.
+         */
+        constexpr reference operator*() const { return *current_; }
+
+        /**
+         * @brief Moves to the next row and prefetches the elements of the row at the lookahead distance.
+         *
+         * @return A reference to the updated iterator.
+         */
+        iterator& operator++()
+        {
+            ++current_;
+            advance_ahead(std::index_sequence_for<Containers...>{});
+            return *this;
+        }
+
+        /**
+         * @brief Moves to the next row and prefetches the elements of the row at the lookahead distance.
+         *
+         * @return A copy of the iterator before it was moved.
+         */
+        iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /**
+         * @brief Checks if two iterators are equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the current rows are equal (any container reached the same position), `false` otherwise.
+         */
+        constexpr bool operator==(const iterator& other) const { return current_ == other.current_; }
+
+        /**
+         * @brief Checks if two iterators are not equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the current rows are not equal, `false` otherwise.
+         */
+        constexpr bool operator!=(const iterator& other) const { return !(*this == other); }
+
+       private:
+        base_iterator current_;
+        iterators ahead_;
+        iterators ends_;
+
+        /**
+         * @brief Moves the lookahead iterators which are not at the end and prefetches their elements.
+         *
+         * @tparam I Indices used to unpack the tuples of iterators.
+         */
+        template <std::size_t... I>
+        void advance_ahead(std::index_sequence<I...>)
+        {
+            (advance_ahead<I>(), ...);
+        }
+
+        /**
+         * @brief Moves the lookahead iterator of a container, if not at the end, and prefetches its element.
+         *
+         * @tparam I The index of the container.
+         */
+        template <std::size_t I>
+        void advance_ahead()
+        {
+            auto& ahead = std::get<I>(ahead_);
+            if (ahead != std::get<I>(ends_) && ++ahead != std::get<I>(ends_)) {
+                detail::prefetch(std::addressof(*ahead));
+            }
+        }
+    };
+
+    /**
+     * @brief Constant iterator over the rows.
+     */
+    using const_iterator = iterator;
+
+    /**
+     * @brief Constructs a view from the lookahead distance and the containers.
+     *
+     * @param distance The number of rows between the current row and the prefetched one. It should cover the memory
+     * latency of a few rows of work; distances from 4 to 16 are usually a good start.
+     * @param containers The containers. Rvalue containers are moved into the view.
+     */
+    constexpr explicit prefetching_zip(const std::size_t distance, detail::zip_parameter_t<Containers>... containers)
+        : containers_{std::forward<detail::zip_parameter_t<Containers>>(containers)...}, distance_{distance}
+    {
+    }
+
+    /**
+     * @brief Returns an iterator to the first row, prefetching the elements of the first `distance` rows.
+     *
+     * @return An iterator to the beginning of the view.
+     */
+    iterator begin() const { return begin_impl(std::index_sequence_for<Containers...>{}); }
+
+    /**
+     * @brief Returns an iterator past the last row, at the end of any container.
+     *
+     * @return An iterator to the end of the view.
+     */
+    iterator end() const { return end_impl(std::index_sequence_for<Containers...>{}); }
+
+    /**
+     * @brief Returns the number of rows, which is the size of the smallest container.
+     *
+     * @return The number of rows.
+     */
+    [[nodiscard]] std::size_t size() const { return size_impl(std::index_sequence_for<Containers...>{}); }
+
+    /**
+     * @brief Checks if the view is empty.
+     *
+     * @return `true` if the view is empty, `false` otherwise.
+     */
+    [[nodiscard]] bool empty() const { return begin() == end(); }
+
+    /**
+     * @brief Returns the lookahead distance.
+     *
+     * @return The number of rows between the current row and the prefetched one.
+     */
+    [[nodiscard]] constexpr std::size_t distance() const noexcept { return distance_; }
+
+   private:
+    std::tuple<detail::zip_storage_t<Containers>...> containers_;
+    std::size_t distance_;
+
+    /**
+     * @brief Returns a container.
+     *
+     * @tparam I The index of the container.
+     * @return A reference to the container.
+     */
+    template <std::size_t I>
+    constexpr auto& container() const noexcept
+    {
+        return detail::unwrap(std::get<I>(containers_));
+    }
+
+    /**
+     * @brief Creates the iterator to the first row, with lookahead iterators `distance` rows ahead (or at the end).
+     *
+     * @tparam I Indices used to unpack the tuple of containers.
+     * @return An iterator to the beginning of the view.
+     */
+    template <std::size_t... I>
+    iterator begin_impl(std::index_sequence<I...>) const
+    {
+        const iterators ends{std::end(container<I>())...};
+        iterators ahead{std::begin(container<I>())...};
+
+        for (std::size_t row = 0; row < distance_; ++row) {
+            ((std::get<I>(ahead) != std::get<I>(ends)
+                  ? (detail::prefetch(std::addressof(*std::get<I>(ahead))), void(++std::get<I>(ahead)))
+                  : void()),
+             ...);
+        }
+
+        return iterator{typename iterator::base_iterator{std::begin(container<I>())...}, ahead, ends};
+    }
+
+    /**
+     * @brief Creates the iterator past the last row.
+     *
+     * @tparam I Indices used to unpack the tuple of containers.
+     * @return An iterator to the end of the view.
+     */
+    template <std::size_t... I>
+    iterator end_impl(std::index_sequence<I...>) const
+    {
+        const iterators ends{std::end(container<I>())...};
+        return iterator{typename iterator::base_iterator{std::end(container<I>())...}, ends, ends};
+    }
+
+    /**
+     * @brief Determines the number of rows as the size of the smallest container.
+     *
+     * @tparam I Indices used to unpack the tuple of containers.
+     * @return The number of rows.
+     */
+    template <std::size_t... I>
+    std::size_t size_impl(std::index_sequence<I...>) const
+    {
+        return std::min({detail::container_size(container<I>())...});
+    }
+};
+
+/**
+ * @brief Deduces the types of the containers of a `prefetching_zip`: lvalues are referenced, rvalues are owned.
+ */
+template <typename... Containers>
+prefetching_zip(std::size_t, Containers&&...) -> prefetching_zip<detail::zip_container_t<Containers>...>;
+
+}  // namespace msd
+
+#endif  // MSD_ZIP_ZIP_PREFETCH_HPP
@@ -0,0 +1,116 @@
+#ifndef MSD_ZIP_ZIP_STREAM_HPP
+#define MSD_ZIP_ZIP_STREAM_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "zip.hpp"
+
+namespace msd {
+
+/**
+ * @brief A single pass view over multiple ranges, which accepts input iterators (e.g. `std::istream_iterator`).
+ *
+ * Unlike `msd::zip`, the sizes of the ranges are never computed, so each range is traversed once, element by element,
+ * and the iteration stops as soon as any range is exhausted. Input ranges (streams, generators) can be iterated only
+ * once.
+ *
+ * @code
+ * std::ifstream times{"times.log"}, values{"values.log"};
+ * msd::streaming_zip zip(msd::iterator_range(std::istream_iterator<long>{times}, {}),
+ *                        msd::iterator_range(std::istream_iterator<double>{values}, {}));
+ * for (auto [time, value] : zip) {}
+ * @endcode
+ *
+ * @tparam Ranges The types of the ranges (`Range&&` for owned ranges).
+ */
+template <typename... Ranges>
+class streaming_zip {
+    static_assert(sizeof...(Ranges) > 1, "streaming_zip requires at least 2 ranges");
+
+   public:
+    /**
+     * @brief Iterator over the ranges, of the weakest category of their iterators. It's equal to the end when any
+     * range is at its end.
+     */
+    using iterator = zip_iterator<detail::iterator_t<std::remove_reference_t<Ranges>>...>;
+
+    /**
+     * @brief The rows are read through the same iterators.
+     */
+    using const_iterator = iterator;
+
+    /**
+     * @brief A tuple of values from each range.
+     */
+    using value_type = typename iterator::value_type;
+
+    /**
+     * @brief A tuple of references from each range.
+     */
+    using reference = typename iterator::reference;
+
+    /**
+     * @brief Constructs a view from the ranges.
+     *
+     * @param ranges The ranges. Rvalue ranges are moved into the view.
+     */
+    constexpr explicit streaming_zip(detail::zip_parameter_t<Ranges>... ranges)
+        : ranges_{std::forward<detail::zip_parameter_t<Ranges>>(ranges)...}
+    {
+    }
+
+    /**
+     * @brief Returns an iterator to the first row, without traversing the ranges.
+     *
+     * @return An iterator to the beginning of the view.
+     */
+    constexpr iterator begin() const { return begin_impl(std::index_sequence_for<Ranges...>{}); }
+
+    /**
+     * @brief Returns an iterator past the last row, without traversing the ranges.
+     *
+     * @return An iterator to the end of the view.
+     */
+    constexpr iterator end() const { return end_impl(std::index_sequence_for<Ranges...>{}); }
+
+   private:
+    std::tuple<detail::zip_storage_t<Ranges>...> ranges_;
+
+    /**
+     * @brief Creates the iterator to the first row.
+     *
+     * @tparam I Indices used to unpack the tuple of ranges.
+     * @return An iterator to the beginning of the view.
+     */
+    template <std::size_t... I>
+    constexpr iterator begin_impl(std::index_sequence<I...>) const
+    {
+        return iterator{std::begin(detail::unwrap(std::get<I>(ranges_)))...};
+    }
+
+    /**
+     * @brief Creates the iterator past the last row.
+     *
+     * @tparam I Indices used to unpack the tuple of ranges.
+     * @return An iterator to the end of the view.
+     */
+    template <std::size_t... I>
+    constexpr iterator end_impl(std::index_sequence<I...>) const
+    {
+        return iterator{std::end(detail::unwrap(std::get<I>(ranges_)))...};
+    }
+};
+
+/**
+ * @brief Deduces the types of the ranges of a `streaming_zip`: lvalues are referenced, rvalues are owned.
+ */
+template <typename... Ranges>
+streaming_zip(Ranges&&...) -> streaming_zip<detail::zip_container_t<Ranges>...>;
+
+}  // namespace msd
+
+#endif  // MSD_ZIP_ZIP_STREAM_HPP
@@ -0,0 +1,699 @@
+#ifndef MSD_ZIP_ZIP_VIEWS_HPP
+#define MSD_ZIP_ZIP_VIEWS_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "zip.hpp"
+
+namespace msd {
+
+namespace detail {
+
+/**
+ * @brief The iterator category of a view over a range: the category of the range, at most forward.
+ *
+ * @tparam Iterator The type of the iterator of the range.
+ */
+template <typename Iterator>
+using view_iterator_category_t =
+    std::common_type_t<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>;
+
+}  // namespace detail
+
+/**
+ * @brief A lazy view applying a function to each element of a range (e.g. `msd::zip`).
+ *
+ * The range is referenced if given as an lvalue and owned if given as an rvalue.
+ *
+ * @tparam Range The type of the range (`Range&&` for owned ranges).
+ * @tparam Function The type of the function.
+ */
+template <typename Range, typename Function>
+class transform_view {
+   public:
+    /**
+     * @brief Iterator over the results of the function applied to the elements of the range.
+     */
+    class iterator {
+       public:
+        /**
+         * @brief The type of the iterator of the range.
+         */
+        using base_iterator = detail::iterator_t<std::remove_reference_t<Range>>;
+
+        /**
+         * @brief The category of the iterator of the range, at most forward.
+         */
+        using iterator_category = detail::view_iterator_category_t<base_iterator>;
+
+        /**
+         * @brief The difference between two iterators.
+         */
+        using difference_type = typename std::iterator_traits<base_iterator>::difference_type;
+
+        /**
+         * @brief The type returned by the function.
+         */
+        using reference =
+            std::invoke_result_t<const Function&, typename std::iterator_traits<base_iterator>::reference>;
+
+        /**
+         * @brief The type of the results of the function.
+         */
+        using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+
+        /**
+         * @brief Results are returned by value.
+         */
+        using pointer = void;
+
+        /**
+         * @brief Constructs an iterator from an iterator of the range and the function.
+         *
+         * @param base The iterator of the range.
+         * @param function The function applied to the elements.
+         */
+        constexpr iterator(base_iterator base, const Function* function) : base_{base}, function_{function} {}
+
+        /**
+         * @brief Applies the function to the current element.
+         *
+         * @return The result of the function.
+         */
+        constexpr reference operator*() const { return std::invoke(*function_, *base_); }
+
+        /**
+         * @brief Advances the iterator by one position.
+         *
+         * @return A reference to the updated iterator.
+         */
+        constexpr iterator& operator++()
+        {
+            ++base_;
+            return *this;
+        }
+
+        /**
+         * @brief Advances the iterator by one position.
+         *
+         * @return A copy of the iterator before it was advanced.
+         */
+        constexpr iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /**
+         * @brief Checks if two iterators are equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the iterators of the range are equal, `false` otherwise.
+         */
+        constexpr bool operator==(const iterator& other) const { return base_ == other.base_; }
+
+        /**
+         * @brief Checks if two iterators are not equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the iterators of the range are not equal, `false` otherwise.
+         */
+        constexpr bool operator!=(const iterator& other) const { return !(*this == other); }
+
+       private:
+        base_iterator base_;
+        const Function* function_;
+    };
+
+    /**
+     * @brief Constructs a view from a range and a function.
+     *
+     * @param range The range to be transformed. Rvalue ranges are moved into the view.
+     * @param function The function applied to each element.
+     */
+    constexpr transform_view(detail::zip_parameter_t<Range> range, Function function)
+        : range_{std::forward<detail::zip_parameter_t<Range>>(range)}, function_{std::move(function)}
+    {
+    }
+
+    /**
+     * @brief Returns an iterator to the result for the first element.
+     *
+     * @return An iterator to the beginning of the view.
+     */
+    constexpr iterator begin() const { return iterator{std::begin(detail::unwrap(range_)), &function_}; }
+
+    /**
+     * @brief Returns an iterator past the result for the last element.
+     *
+     * @return An iterator to the end of the view.
+     */
+    constexpr iterator end() const { return iterator{std::end(detail::unwrap(range_)), &function_}; }
+
+    /**
+     * @brief Returns the number of elements, which is the size of the range.
+     *
+     * @return The number of elements in the view.
+     */
+    [[nodiscard]] constexpr std::size_t size() const { return detail::container_size(detail::unwrap(range_)); }
+
+    /**
+     * @brief Checks if the view is empty.
+     *
+     * @return `true` if the view is empty, `false` otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const { return begin() == end(); }
+
+   private:
+    detail::zip_storage_t<Range> range_;
+    Function function_;
+};
+
+/**
+ * @brief A lazy view over the elements of a range (e.g. `msd::zip`) which satisfy a predicate.
+ *
+ * The beginning of the view is found each time `begin()` is called, by applying the predicate until it's satisfied.
+ *
+ * @tparam Range The type of the range (`Range&&` for owned ranges).
+ * @tparam Predicate The type of the predicate.
+ */
+template <typename Range, typename Predicate>
+class filter_view {
+   public:
+    /**
+     * @brief Iterator over the elements of the range which satisfy the predicate.
+     */
+    class iterator {
+       public:
+        /**
+         * @brief The type of the iterator of the range.
+         */
+        using base_iterator = detail::iterator_t<std::remove_reference_t<Range>>;
+
+        /**
+         * @brief The category of the iterator of the range, at most forward.
+         */
+        using iterator_category = detail::view_iterator_category_t<base_iterator>;
+
+        /**
+         * @brief The difference between two iterators.
+         */
+        using difference_type = typename std::iterator_traits<base_iterator>::difference_type;
+
+        /**
+         * @brief The type of the elements of the range.
+         */
+        using value_type = typename std::iterator_traits<base_iterator>::value_type;
+
+        /**
+         * @brief The type of the references to the elements of the range.
+         */
+        using reference = typename std::iterator_traits<base_iterator>::reference;
+
+        /**
+         * @brief The type of the pointers to the elements of the range.
+         */
+        using pointer = typename std::iterator_traits<base_iterator>::pointer;
+
+        /**
+         * @brief Constructs an iterator positioned at the first element, starting with `base`, which satisfies the
+         * predicate.
+         *
+         * @param base The iterator of the range to start from.
+         * @param last The end of the range.
+         * @param predicate The predicate the elements must satisfy.
+         */
+        constexpr iterator(base_iterator base, base_iterator last, const Predicate* predicate)
+            : base_{base}, last_{last}, predicate_{predicate}
+        {
+            satisfy();
+        }
+
+        /**
+         * @brief Dereferences the iterator.
+         *
+         * @return The current element.
+         */
+        constexpr reference operator*() const { return *base_; }
+
+        /**
+         * @brief Advances the iterator to the next element which satisfies the predicate.
+         *
+         * @return A reference to the updated iterator.
+         */
+        constexpr iterator& operator++()
+        {
+            ++base_;
+            satisfy();
+            return *this;
+        }
+
+        /**
+         * @brief Advances the iterator to the next element which satisfies the predicate.
+         *
+         * @return A copy of the iterator before it was advanced.
+         */
+        constexpr iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /**
+         * @brief Checks if two iterators are equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the iterators of the range are equal, `false` otherwise.
+         */
+        constexpr bool operator==(const iterator& other) const { return base_ == other.base_; }
+
+        /**
+         * @brief Checks if two iterators are not equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the iterators of the range are not equal, `false` otherwise.
+         */
+        constexpr bool operator!=(const iterator& other) const { return !(*this == other); }
+
+       private:
+        /**
+         * @brief Advances the iterator of the range until an element satisfies the predicate or the end is reached.
+         */
+        constexpr void satisfy()
+        {
+            while (base_ != last_ && !std::invoke(*predicate_, *base_)) {
+                ++base_;
+            }
+        }
+
+        base_iterator base_;
+        base_iterator last_;
+        const Predicate* predicate_;
+    };
+
+    /**
+     * @brief Constructs a view from a range and a predicate.
+     *
+     * @param range The range to be filtered. Rvalue ranges are moved into the view.
+     * @param predicate The predicate the elements must satisfy.
+     */
+    constexpr filter_view(detail::zip_parameter_t<Range> range, Predicate predicate)
+        : range_{std::forward<detail::zip_parameter_t<Range>>(range)}, predicate_{std::move(predicate)}
+    {
+    }
+
+    /**
+     * @brief Returns an iterator to the first element which satisfies the predicate.
+     *
+     * @return An iterator to the beginning of the view.
+     */
+    constexpr iterator begin() const
+    {
+        return iterator{std::begin(detail::unwrap(range_)), std::end(detail::unwrap(range_)), &predicate_};
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the range.
+     *
+     * @return An iterator to the end of the view.
+     */
+    constexpr iterator end() const
+    {
+        return iterator{std::end(detail::unwrap(range_)), std::end(detail::unwrap(range_)), &predicate_};
+    }
+
+    /**
+     * @brief Checks if no element satisfies the predicate.
+     *
+     * @return `true` if the view is empty, `false` otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const { return begin() == end(); }
+
+   private:
+    detail::zip_storage_t<Range> range_;
+    Predicate predicate_;
+};
+
+/**
+ * @brief A lazy view over at most the first `count` elements of a range (e.g. `msd::zip`).
+ *
+ * @tparam Range The type of the range (`Range&&` for owned ranges).
+ */
+template <typename Range>
+class take_view {
+   public:
+    /**
+     * @brief Iterator over the first elements of the range, counting the elements left.
+     */
+    class iterator {
+       public:
+        /**
+         * @brief The type of the iterator of the range.
+         */
+        using base_iterator = detail::iterator_t<std::remove_reference_t<Range>>;
+
+        /**
+         * @brief The category of the iterator of the range, at most forward.
+         */
+        using iterator_category = detail::view_iterator_category_t<base_iterator>;
+
+        /**
+         * @brief The difference between two iterators.
+         */
+        using difference_type = typename std::iterator_traits<base_iterator>::difference_type;
+
+        /**
+         * @brief The type of the elements of the range.
+         */
+        using value_type = typename std::iterator_traits<base_iterator>::value_type;
+
+        /**
+         * @brief The type of the references to the elements of the range.
+         */
+        using reference = typename std::iterator_traits<base_iterator>::reference;
+
+        /**
+         * @brief The type of the pointers to the elements of the range.
+         */
+        using pointer = typename std::iterator_traits<base_iterator>::pointer;
+
+        /**
+         * @brief Constructs an iterator from an iterator of the range and the number of elements left.
+         *
+         * @param base The iterator of the range.
+         * @param count The number of elements left to be taken.
+         */
+        constexpr iterator(base_iterator base, const std::size_t count) : base_{base}, count_{count} {}
+
+        /**
+         * @brief Dereferences the iterator.
+         *
+         * @return The current element.
+         */
+        constexpr reference operator*() const { return *base_; }
+
+        /**
+         * @brief Advances the iterator by one position.
+         *
+         * @return A reference to the updated iterator.
+         */
+        constexpr iterator& operator++()
+        {
+            ++base_;
+            --count_;
+            return *this;
+        }
+
+        /**
+         * @brief Advances the iterator by one position.
+         *
+         * @return A copy of the iterator before it was advanced.
+         */
+        constexpr iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /**
+         * @brief Checks if two iterators are equal.
+         *
+         * The iterators are equal if they have the same number of elements left or if the iterators of the range are
+         * equal, so the view ends after `count` elements or at the end of a shorter range.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the iterators are equal, `false` otherwise.
+         */
+        constexpr bool operator==(const iterator& other) const
+        {
+            return count_ == other.count_ || base_ == other.base_;
+        }
+
+        /**
+         * @brief Checks if two iterators are not equal.
+         *
+         * @param other The other iterator to compare with.
+         * @return `true` if the iterators are not equal, `false` otherwise.
+         */
+        constexpr bool operator!=(const iterator& other) const { return !(*this == other); }
+
+       private:
+        base_iterator base_;
+        std::size_t count_;
+    };
+
+    /**
+     * @brief Constructs a view from a range and the number of elements to be taken.
+     *
+     * @param range The range to take the elements from. Rvalue ranges are moved into the view.
+     * @param count The maximum number of elements to be taken.
+     */
+    constexpr take_view(detail::zip_parameter_t<Range> range, const std::size_t count)
+        : range_{std::forward<detail::zip_parameter_t<Range>>(range)}, count_{count}
+    {
+    }
+
+    /**
+     * @brief Returns an iterator to the first element.
+     *
+     * @return An iterator to the beginning of the view.
+     */
+    constexpr iterator begin() const { return iterator{std::begin(detail::unwrap(range_)), count_}; }
+
+    /**
+     * @brief Returns an iterator past the last taken element.
+     *
+     * @return An iterator to the end of the view.
+     */
+    constexpr iterator end() const { return iterator{std::end(detail::unwrap(range_)), 0}; }
+
+    /**
+     * @brief Returns the number of taken elements: the smallest of `count` and the size of the range.
+     *
+     * @return The number of elements in the view.
+     */
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        const auto size = detail::container_size(detail::unwrap(range_));
+        return size < count_ ? size : count_;
+    }
+
+    /**
+     * @brief Checks if the view is empty.
+     *
+     * @return `true` if the view is empty, `false` otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const { return begin() == end(); }
+
+   private:
+    detail::zip_storage_t<Range> range_;
+    std::size_t count_;
+};
+
+/**
+ * @brief A lazy view over the elements of a range (e.g. `msd::zip`) after the first `count` elements.
+ *
+ * Its iterators are the iterators of the range.
+ *
+ * @tparam Range The type of the range (`Range&&` for owned ranges).
+ */
+template <typename Range>
+class drop_view {
+   public:
+    /**
+     * @brief The iterator of the range.
+     */
+    using iterator = detail::iterator_t<std::remove_reference_t<Range>>;
+
+    /**
+     * @brief Constructs a view from a range and the number of elements to be dropped.
+     *
+     * @param range The range to drop the elements from. Rvalue ranges are moved into the view.
+     * @param count The number of elements to be dropped.
+     */
+    constexpr drop_view(detail::zip_parameter_t<Range> range, const std::size_t count)
+        : range_{std::forward<detail::zip_parameter_t<Range>>(range)}, count_{count}
+    {
+    }
+
+    /**
+     * @brief Returns an iterator to the first element after the dropped ones, or the end if the range is shorter.
+     *
+     * Random access ranges are advanced in constant time, other ranges are traversed.
+     *
+     * @return An iterator to the beginning of the view.
+     */
+    constexpr iterator begin() const
+    {
+        auto& range = detail::unwrap(range_);
+        const auto last = std::end(range);
+
+        if constexpr (std::is_base_of_v<std::random_access_iterator_tag,
+                                        typename std::iterator_traits<iterator>::iterator_category>) {
+            const auto size = detail::container_size(range);
+            return std::next(std::begin(range), static_cast<std::ptrdiff_t>(size < count_ ? size : count_));
+        }
+        else {
+            auto first = std::begin(range);
+            for (std::size_t i = 0; i < count_ && first != last; ++i) {
+                ++first;
+            }
+            return first;
+        }
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the range.
+     *
+     * @return An iterator to the end of the view.
+     */
+    constexpr iterator end() const { return std::end(detail::unwrap(range_)); }
+
+    /**
+     * @brief Returns the number of elements left after dropping the first `count` elements.
+     *
+     * @return The number of elements in the view.
+     */
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        const auto size = detail::container_size(detail::unwrap(range_));
+        return size < count_ ? 0 : size - count_;
+    }
+
+    /**
+     * @brief Checks if the view is empty.
+     *
+     * @return `true` if the view is empty, `false` otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const { return begin() == end(); }
+
+   private:
+    detail::zip_storage_t<Range> range_;
+    std::size_t count_;
+};
+
+/**
+ * @brief Deduces the type of the range of a `transform_view`: lvalues are referenced, rvalues are owned.
+ */
+template <typename Range, typename Function>
+transform_view(Range&&, Function) -> transform_view<detail::zip_container_t<Range>, Function>;
+
+/**
+ * @brief Deduces the type of the range of a `filter_view`: lvalues are referenced, rvalues are owned.
+ */
+template <typename Range, typename Predicate>
+filter_view(Range&&, Predicate) -> filter_view<detail::zip_container_t<Range>, Predicate>;
+
+/**
+ * @brief Deduces the type of the range of a `take_view`: lvalues are referenced, rvalues are owned.
+ */
+template <typename Range>
+take_view(Range&&, std::size_t) -> take_view<detail::zip_container_t<Range>>;
+
+/**
+ * @brief Deduces the type of the range of a `drop_view`: lvalues are referenced, rvalues are owned.
+ */
+template <typename Range>
+drop_view(Range&&, std::size_t) -> drop_view<detail::zip_container_t<Range>>;
+
+namespace detail {
+
+/**
+ * @brief Creates a view when applied to a range with the pipe operator: `range | adaptor`.
+ *
+ * @tparam Factory The type of the function creating the view from a range.
+ */
+template <typename Factory>
+class view_adaptor {
+   public:
+    /**
+     * @brief Constructs an adaptor from a function creating the view.
+     *
+     * @param factory The function creating the view from a range.
+     */
+    constexpr explicit view_adaptor(Factory factory) : factory_{std::move(factory)} {}
+
+    /**
+     * @brief Creates a view over a range.
+     *
+     * @tparam Range The type of the range.
+     * @param range The range. Lvalues are referenced, rvalues are moved into the view.
+     * @param adaptor The adaptor creating the view.
+     * @return The view.
+     */
+    template <typename Range>
+    friend constexpr auto operator|(Range&& range, const view_adaptor& adaptor)
+    {
+        return adaptor.factory_(std::forward<Range>(range));
+    }
+
+   private:
+    Factory factory_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Lazily applies a function to each element of a range: `msd::zip(a, b) | msd::transform(function)`.
+ *
+ * @tparam Function The type of the function.
+ * @param function The function, which receives an element of the range (a tuple of references for a zip).
+ * @return An adaptor creating a `transform_view`.
+ */
+template <typename Function>
+constexpr auto transform(Function function)
+{
+    return detail::view_adaptor{[function = std::move(function)](auto&& range) {
+        return transform_view{std::forward<decltype(range)>(range), function};
+    }};
+}
+
+/**
+ * @brief Lazily keeps the elements of a range which satisfy a predicate: `msd::zip(a, b) | msd::filter(predicate)`.
+ *
+ * @tparam Predicate The type of the predicate.
+ * @param predicate The predicate, which receives an element of the range (a tuple of references for a zip).
+ * @return An adaptor creating a `filter_view`.
+ */
+template <typename Predicate>
+constexpr auto filter(Predicate predicate)
+{
+    return detail::view_adaptor{[predicate = std::move(predicate)](auto&& range) {
+        return filter_view{std::forward<decltype(range)>(range), predicate};
+    }};
+}
+
+/**
+ * @brief Lazily keeps at most the first elements of a range: `msd::zip(a, b) | msd::take(count)`.
+ *
+ * @param count The maximum number of elements to be kept.
+ * @return An adaptor creating a `take_view`.
+ */
+constexpr auto take(const std::size_t count)
+{
+    return detail::view_adaptor{
+        [count](auto&& range) { return take_view{std::forward<decltype(range)>(range), count}; }};
+}
+
+/**
+ * @brief Lazily skips the first elements of a range: `msd::zip(a, b) | msd::drop(count)`.
+ *
+ * @param count The number of elements to be skipped.
+ * @return An adaptor creating a `drop_view`.
+ */
+constexpr auto drop(const std::size_t count)
+{
+    return detail::view_adaptor{
+        [count](auto&& range) { return drop_view{std::forward<decltype(range)>(range), count}; }};
+}
+
+}  // namespace msd
+
+#endif  // MSD_ZIP_ZIP_VIEWS_HPP
@@ -0,0 +1,187 @@
+#ifndef MSD_ZIP_TESTS_HARDWARE_COUNTERS_HPP
+#define MSD_ZIP_TESTS_HARDWARE_COUNTERS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+/**
+ * @brief Counts hardware events of the calling thread with Linux `perf_event_open`: cycles, instructions, cache misses
+ * and branch misses.
+ *
+ * The events are opened as a group, so they are always counted together. If the counters are not available (other
+ * systems, virtual machines without a PMU, `kernel.perf_event_paranoid` forbidding them), all operations do nothing
+ * and no values are read.
+ */
+class hardware_counters {
+   public:
+    /**
+     * @brief The number of counted events.
+     */
+    static constexpr std::size_t kEvents = 4;
+
+    /**
+     * @brief The names of the counted events, in the order of the values.
+     */
+    static constexpr std::array<const char*, kEvents> kNames{"cycles", "instructions", "cache_misses", "branch_misses"};
+
+    /**
+     * @brief Opens the counters, disabled.
+     */
+    hardware_counters()
+    {
+#if defined(__linux__)
+        constexpr std::array<std::uint64_t, kEvents> configs{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                             PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+        for (std::size_t i = 0; i < kEvents; ++i) {
+            perf_event_attr attributes{};
+            attributes.size = sizeof(attributes);
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = configs[i];
+            attributes.disabled = i == 0 ? 1 : 0;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            const auto descriptor = syscall(SYS_perf_event_open, &attributes, 0, -1, i == 0 ? -1 : descriptors_[0], 0);
+            if (descriptor < 0) {
+                error_ = std::string{"perf_event_open("} + kNames[i] + "): " + std::strerror(errno);
+                close_all();
+                return;
+            }
+            descriptors_[i] = static_cast<int>(descriptor);
+        }
+#else
+        error_ = "perf_event_open is available only on Linux";
+#endif
+    }
+
+    hardware_counters(const hardware_counters&) = delete;
+    hardware_counters& operator=(const hardware_counters&) = delete;
+    hardware_counters(hardware_counters&&) = delete;
+    hardware_counters& operator=(hardware_counters&&) = delete;
+
+    /**
+     * @brief Closes the counters.
+     */
+    ~hardware_counters() { close_all(); }
+
+    /**
+     * @brief Checks if the counters are available.
+     *
+     * @return `true` if the counters were opened, `false` otherwise.
+     */
+    [[nodiscard]] bool available() const noexcept { return descriptors_[0] >= 0; }
+
+    /**
+     * @brief Returns why the counters are not available.
+     *
+     * @return The error, empty if the counters are available.
+     */
+    [[nodiscard]] const std::string& error() const noexcept { return error_; }
+
+    /**
+     * @brief Resets the counters to zero and starts counting.
+     */
+    void start() noexcept
+    {
+        control(action::kReset);
+        control(action::kEnable);
+    }
+
+    /**
+     * @brief Stops counting, keeping the counted values.
+     */
+    void pause() noexcept { control(action::kDisable); }
+
+    /**
+     * @brief Continues counting after pause().
+     */
+    void resume() noexcept { control(action::kEnable); }
+
+    /**
+     * @brief Stops counting and reads the values of the events, scaled if the kernel multiplexed the counters.
+     *
+     * @param values The values, in the order of `kNames`.
+     * @return `true` if the values were read, `false` if the counters are not available.
+     */
+    bool stop(std::array<double, kEvents>& values) noexcept
+    {
+#if defined(__linux__)
+        if (!available()) {
+            return false;
+        }
+        pause();
+
+        // Layout of PERF_FORMAT_GROUP with both total times: number of events, time enabled, time running, values.
+        std::array<std::uint64_t, 3 + kEvents> buffer{};
+        if (read(descriptors_[0], buffer.data(), sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer)) ||
+            buffer[2] == 0) {
+            return false;
+        }
+
+        const auto scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+        for (std::size_t i = 0; i < kEvents; ++i) {
+            values[i] = static_cast<double>(buffer[3 + i]) * scale;
+        }
+        return true;
+#else
+        static_cast<void>(values);
+        return false;
+#endif
+    }
+
+   private:
+    enum class action { kReset, kEnable, kDisable };
+
+    std::array<int, kEvents> descriptors_{-1, -1, -1, -1};
+    std::string error_;
+
+    void control([[maybe_unused]] const action request) noexcept
+    {
+#if defined(__linux__)
+        if (!available()) {
+            return;
+        }
+
+        switch (request) {
+            case action::kReset:
+                ioctl(descriptors_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                break;
+            case action::kEnable:
+                ioctl(descriptors_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+                break;
+            case action::kDisable:
+                ioctl(descriptors_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+                break;
+        }
+#endif
+    }
+
+    void close_all() noexcept
+    {
+#if defined(__linux__)
+        for (auto& descriptor : descriptors_) {
+            if (descriptor >= 0) {
+                close(descriptor);
+                descriptor = -1;
+            }
+        }
+#endif
+    }
+};
+
+#endif  // MSD_ZIP_TESTS_HARDWARE_COUNTERS_HPP
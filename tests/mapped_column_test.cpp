@@ -0,0 +1,198 @@
+#if __has_include(<sys/mman.h>)
+
+#include "msd/mapped_column.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "msd/zip.hpp"
+
+class MappedColumnTest : public testing::Test {
+   protected:
+    const std::vector<std::int64_t> times_{10, 20, 30, 40, 50};
+    const std::vector<double> prices_{1.5, 2.5, 3.5, 4.5};
+
+    std::string times_path_ = temporary_path("times");
+    std::string prices_path_ = temporary_path("prices");
+
+    void SetUp() override
+    {
+        write(times_path_, times_);
+        write(prices_path_, prices_);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(times_path_);
+        std::filesystem::remove(prices_path_);
+    }
+
+    static std::string temporary_path(const std::string& name)
+    {
+        const auto* test = testing::UnitTest::GetInstance()->current_test_info();
+        return (std::filesystem::temp_directory_path() /
+                ("msd_zip_" + std::string{test->name()} + "_" + name + ".bin"))
+            .string();
+    }
+
+    template <typename T>
+    static void write(const std::string& path, const std::vector<T>& values)
+    {
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(values.data()),
+                   static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+
+    template <typename T>
+    static std::vector<T> read(const std::string& path)
+    {
+        std::vector<T> values(std::filesystem::file_size(path) / sizeof(T));
+        std::ifstream file{path, std::ios::binary};
+        file.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+        return values;
+    }
+};
+
+// GIVEN: Binary files of values
+// WHEN: The files are mapped as columns
+// THEN: The columns must be contiguous ranges over the values of the files
+TEST_F(MappedColumnTest, MapsFile)
+{
+    const msd::mapped_column<std::int64_t> times{times_path_};
+
+    static_assert(std::is_same_v<decltype(times.begin()), const std::int64_t*>);
+    static_assert(std::is_same_v<msd::mapped_column<std::int64_t>::iterator, const std::int64_t*>);
+    static_assert(std::is_same_v<msd::mapped_column<std::int64_t>::reference, const std::int64_t&>);
+    EXPECT_EQ(times.size(), times_.size());
+    EXPECT_FALSE(times.empty());
+    EXPECT_EQ(std::vector<std::int64_t>(times.begin(), times.end()), times_);
+    EXPECT_EQ(times[2], 30);
+}
+
+// GIVEN: Two columns mapped from files of different sizes
+// WHEN: The columns are zipped
+// THEN: The rows must hold the values of the files, up to the shortest one
+TEST_F(MappedColumnTest, Zip)
+{
+    msd::mapped_column<std::int64_t> times{times_path_};
+    msd::mapped_column<double> prices{prices_path_};
+
+    std::vector<std::tuple<std::int64_t, double>> rows;
+    for (auto [time, price] : msd::zip(times, prices)) {
+        rows.emplace_back(time, price);
+    }
+
+    const std::vector<std::tuple<std::int64_t, double>> expected{{10, 1.5}, {20, 2.5}, {30, 3.5}, {40, 4.5}};
+    EXPECT_EQ(rows, expected);
+}
+
+// GIVEN: Columns constructed in place in a zip
+// WHEN: The zip is iterated
+// THEN: The zip must own the columns and iterate them with a single offset, as contiguous containers
+TEST_F(MappedColumnTest, ZipOwnsColumns)
+{
+    msd::zip zip(msd::mapped_column<std::int64_t>{times_path_}, msd::mapped_column<double>{prices_path_});
+
+    static_assert(std::is_same_v<decltype(zip.begin()), msd::offset_zip_iterator<const std::int64_t*, const double*>>);
+    EXPECT_EQ(zip.size(), prices_.size());
+
+    double total = 0;
+    for (auto [time, price] : zip) {
+        total += static_cast<double>(time) * price;
+    }
+    EXPECT_DOUBLE_EQ(total, 10 * 1.5 + 20 * 2.5 + 30 * 3.5 + 40 * 4.5);
+}
+
+// GIVEN: A column mapped read-write
+// WHEN: Its values are modified through a zip and the column is flushed
+// THEN: The file must hold the modified values
+TEST_F(MappedColumnTest, ReadWriteChangesFile)
+{
+    {
+        msd::mapped_column<double, msd::map_mode::kReadWrite> prices{prices_path_};
+        msd::mapped_column<std::int64_t> times{times_path_};
+
+        for (auto [price, time] : msd::zip(prices, times)) {
+            price += static_cast<double>(time);
+        }
+        prices.flush();
+    }
+
+    EXPECT_EQ(read<double>(prices_path_), (std::vector<double>{11.5, 22.5, 33.5, 44.5}));
+}
+
+// GIVEN: A column mapped copy-on-write
+// WHEN: Its values are modified
+// THEN: The column must hold the modified values, but the file must not change
+TEST_F(MappedColumnTest, CopyOnWriteKeepsFile)
+{
+    {
+        msd::mapped_column<double, msd::map_mode::kCopyOnWrite> prices{prices_path_, msd::map_advice::kWillNeed};
+        static_assert(std::is_same_v<decltype(prices.data()), double*>);
+
+        prices[0] = 100;
+        EXPECT_EQ(prices[0], 100);
+    }
+
+    EXPECT_EQ(read<double>(prices_path_), prices_);
+}
+
+// GIVEN: A mapped column
+// WHEN: It's moved
+// THEN: The mapping must be moved and the moved from column must be empty
+TEST_F(MappedColumnTest, Move)
+{
+    msd::mapped_column<std::int64_t> times{times_path_, msd::map_advice::kNormal};
+    const auto* data = times.data();
+
+    msd::mapped_column<std::int64_t> moved{std::move(times)};
+    EXPECT_EQ(moved.data(), data);
+    EXPECT_EQ(moved.size(), times_.size());
+    EXPECT_TRUE(times.empty());  // NOLINT(bugprone-use-after-move)
+    EXPECT_EQ(times.data(), nullptr);
+
+    msd::mapped_column<std::int64_t> assigned{prices_path_};
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.data(), data);
+    EXPECT_EQ(std::vector<std::int64_t>(assigned.begin(), assigned.end()), times_);
+    assigned.advise(msd::map_advice::kSequential);
+}
+
+// GIVEN: An empty file
+// WHEN: It's mapped
+// THEN: The column must be empty
+TEST_F(MappedColumnTest, EmptyFile)
+{
+    write(times_path_, std::vector<std::int64_t>{});
+
+    msd::mapped_column<std::int64_t, msd::map_mode::kReadWrite> times{times_path_};
+    EXPECT_TRUE(times.empty());
+    EXPECT_EQ(times.begin(), times.end());
+    EXPECT_TRUE(msd::zip(times, prices_).empty());
+    times.flush();
+}
+
+// GIVEN: A missing file or a file which doesn't hold a whole number of values
+// WHEN: It's mapped
+// THEN: An exception must be thrown
+TEST_F(MappedColumnTest, InvalidFile)
+{
+    EXPECT_THROW(msd::mapped_column<double>{temporary_path("missing")}, std::system_error);
+    EXPECT_THROW(msd::mapped_column<double>{times_path_ + ".missing"}, std::system_error);
+
+    write(prices_path_, std::vector<char>{1, 2, 3});
+    EXPECT_THROW(msd::mapped_column<double>{prices_path_}, std::invalid_argument);
+}
+
+#endif
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "msd/zip.hpp"
+
+class OffsetZipIteratorTest : public testing::Test {
+   protected:
+    const std::array<int, 3> arr_three_{1, 2, 3};
+    std::vector<int> vector_two_{4, 5};
+    const std::vector<int> vector_four_{6, 7, 8, 9};
+
+    using iterator_type = msd::offset_zip_iterator<const int*, int*, const int*>;
+
+    iterator_type begin_iterator_{0, arr_three_.data(), vector_two_.data(), vector_four_.data()};
+    iterator_type end_iterator_{2, arr_three_.data(), vector_two_.data(), vector_four_.data()};
+};
+
+// GIVEN: An offset_zip_iterator object is created with the beginning of three containers
+// WHEN: Iterator traits are verified
+// THEN: The traits should match the expected values for a random access iterator with the appropriate types for value,
+// pointer, and reference
+TEST_F(OffsetZipIteratorTest, IteratorTraits)
+{
+    static_assert(std::is_same_v<iterator_type::iterator_category, std::random_access_iterator_tag>);
+    static_assert(std::is_same_v<iterator_type::difference_type, std::ptrdiff_t>);
+    static_assert(std::is_same_v<iterator_type::value_type, std::tuple<int, int, int>>);
+    static_assert(std::is_same_v<iterator_type::pointer, std::tuple<const int*, int*, const int*>>);
+    static_assert(std::is_same_v<iterator_type::reference, msd::zip_reference<const int&, int&, const int&>>);
+}
+
+// GIVEN: An offset_zip_iterator object is created with the beginning of three containers
+// WHEN: The dereference operator (*) is used to access the elements
+// THEN: The values of the elements should match the expected values, and modifications should be reflected correctly
+TEST_F(OffsetZipIteratorTest, OperatorDereference)
+{
+    auto [a, b, c] = *begin_iterator_;
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, 4);
+    EXPECT_EQ(c, 6);
+
+    b += 1;
+
+    EXPECT_EQ(vector_two_[0], 5);
+    EXPECT_EQ(std::get<1>(*begin_iterator_), 5);
+}
+
+// GIVEN: An offset_zip_iterator object pointing to the beginning of the containers
+// WHEN: The subscript operator ([]) is used
+// THEN: The elements at the specified offset should be returned
+TEST_F(OffsetZipIteratorTest, OperatorSubscript)
+{
+    auto [a, b, c] = begin_iterator_[1];
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 5);
+    EXPECT_EQ(c, 7);
+
+    auto [ea, eb, ec] = end_iterator_[-2];
+    EXPECT_EQ(ea, 1);
+    EXPECT_EQ(eb, 4);
+    EXPECT_EQ(ec, 6);
+}
+
+// GIVEN: offset_zip_iterator objects pointing to different positions
+// WHEN: The comparison operators are used
+// THEN: The iterators should be compared by their offsets
+TEST_F(OffsetZipIteratorTest, ComparisonOperators)
+{
+    const auto middle = begin_iterator_ + 1;
+
+    EXPECT_EQ(begin_iterator_, begin_iterator_);
+    EXPECT_NE(begin_iterator_, middle);
+    EXPECT_LT(begin_iterator_, middle);
+    EXPECT_LE(begin_iterator_, middle);
+    EXPECT_LE(middle, middle);
+    EXPECT_GT(end_iterator_, middle);
+    EXPECT_GE(end_iterator_, middle);
+    EXPECT_GE(middle, middle);
+}
+
+// GIVEN: An offset_zip_iterator object pointing to the beginning of the containers
+// WHEN: The increment and decrement operators are used
+// THEN: The iterator should be moved by one position
+TEST_F(OffsetZipIteratorTest, IncrementAndDecrement)
+{
+    auto iterator = begin_iterator_;
+
+    ++iterator;
+    EXPECT_EQ(iterator, begin_iterator_ + 1);
+
+    EXPECT_EQ(iterator++, begin_iterator_ + 1);
+    EXPECT_EQ(iterator, end_iterator_);
+
+    --iterator;
+    EXPECT_EQ(iterator, end_iterator_ - 1);
+
+    EXPECT_EQ(iterator--, end_iterator_ - 1);
+    EXPECT_EQ(iterator, begin_iterator_);
+}
+
+// GIVEN: An offset_zip_iterator object pointing to the beginning of the containers
+// WHEN: The arithmetic operators are used
+// THEN: The iterator should be moved by the specified offset
+TEST_F(OffsetZipIteratorTest, ArithmeticOperators)
+{
+    auto iterator = begin_iterator_;
+
+    iterator += 2;
+    EXPECT_EQ(iterator, end_iterator_);
+
+    iterator -= 1;
+    auto [a, b, c] = *iterator;
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 5);
+    EXPECT_EQ(c, 7);
+
+    EXPECT_EQ(begin_iterator_ + 2, end_iterator_);
+    EXPECT_EQ(2 + begin_iterator_, end_iterator_);
+    EXPECT_EQ(end_iterator_ - 2, begin_iterator_);
+    EXPECT_EQ(end_iterator_ - begin_iterator_, 2);
+    EXPECT_EQ(begin_iterator_ - end_iterator_, -2);
+}
+
+// GIVEN: An offset_zip_iterator object pointing to the beginning of the containers and the end iterator
+// WHEN: std::distance, std::next and std::prev are used
+// THEN: The results should match the offsets of the iterators
+TEST_F(OffsetZipIteratorTest, StdIteratorFunctions)
+{
+    EXPECT_EQ(std::distance(begin_iterator_, end_iterator_), 2);
+    EXPECT_EQ(std::next(begin_iterator_, 2), end_iterator_);
+    EXPECT_EQ(std::prev(end_iterator_, 2), begin_iterator_);
+}
+
+// GIVEN: Contiguous containers
+// WHEN: They are zipped together
+// THEN: The zip should iterate over them with an offset_zip_iterator
+TEST_F(OffsetZipIteratorTest, ZipOfContiguousContainers)
+{
+    msd::zip zip(arr_three_, vector_two_, vector_four_);
+
+    static_assert(std::is_same_v<decltype(zip)::iterator, iterator_type>);
+    static_assert(std::is_same_v<decltype(zip)::const_iterator,
+                                 msd::offset_zip_iterator<const int*, const int*, const int*>>);
+
+    EXPECT_EQ(zip.begin(), begin_iterator_);
+    EXPECT_EQ(zip.end(), end_iterator_);
+
+    for (auto [a, b, c] : zip) {
+        b = a + c;
+    }
+    EXPECT_EQ(vector_two_, (std::vector<int>{7, 9}));
+
+    EXPECT_TRUE(std::equal(zip.cbegin(), zip.cend(), zip.begin(), zip.end()));
+}
+
+// GIVEN: An offset_zip_iterator over pointers
+// WHEN: Its exception specifications and copyability are verified
+// THEN: It should be trivially copyable and its operations should not throw
+TEST_F(OffsetZipIteratorTest, NoexceptAndTriviallyCopyable)
+{
+    iterator_type iterator = begin_iterator_;
+
+    static_assert(std::is_trivially_copyable_v<iterator_type>);
+    static_assert(std::is_nothrow_copy_constructible_v<iterator_type>);
+    static_assert(noexcept(*iterator));
+    static_assert(noexcept(iterator[1]));
+    static_assert(noexcept(++iterator));
+    static_assert(noexcept(iterator++));
+    static_assert(noexcept(iterator -= 1));
+    static_assert(noexcept(iterator + 1));
+    static_assert(noexcept(iterator == end_iterator_));
+    static_assert(noexcept(iterator < end_iterator_));
+    static_assert(noexcept(end_iterator_ - iterator));
+
+    static_assert(noexcept(msd::zip(vector_two_, arr_three_)));
+
+    EXPECT_EQ(iterator, begin_iterator_);
+}
@@ -0,0 +1,316 @@
+#include "msd/unzip.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "msd/zip.hpp"
+#include "msd/zip_stream.hpp"
+#include "msd/zip_views.hpp"
+
+/**
+ * @brief A value counting how many times it was copied and moved.
+ */
+class tracked {
+   public:
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    tracked() = default;
+    explicit tracked(const int value) : value_{value} {}
+    tracked(const tracked& other) : value_{other.value_} { ++copies; }
+    tracked(tracked&& other) noexcept : value_{other.value_} { ++moves; }
+    tracked& operator=(const tracked& other)
+    {
+        value_ = other.value_;
+        ++copies;
+        return *this;
+    }
+    tracked& operator=(tracked&& other) noexcept
+    {
+        value_ = other.value_;
+        ++moves;
+        return *this;
+    }
+    ~tracked() = default;
+
+    [[nodiscard]] int value() const { return value_; }
+
+    bool operator==(const tracked& other) const { return value_ == other.value_; }
+
+   private:
+    int value_{0};
+};
+
+/**
+ * @brief An output recording how its memory was reserved.
+ */
+class recording_output {
+   public:
+    std::vector<int> values;
+    std::vector<std::size_t> reserves;
+
+    void reserve(const std::size_t capacity)
+    {
+        reserves.push_back(capacity);
+        values.reserve(capacity);
+    }
+
+    [[nodiscard]] std::size_t size() const { return values.size(); }
+
+    void push_back(const int value) { values.push_back(value); }
+};
+
+class UnzipTest : public testing::Test {
+   protected:
+    std::vector<int> ids_{1, 2, 3};
+    std::vector<std::string> names_{"a", "b", "c", "d"};
+
+    void SetUp() override
+    {
+        tracked::copies = 0;
+        tracked::moves = 0;
+    }
+
+    static std::vector<tracked> make_tracked(const std::vector<int>& values)
+    {
+        std::vector<tracked> result;
+        result.reserve(values.size());
+        for (const auto value : values) {
+            result.emplace_back(value);
+        }
+        tracked::copies = 0;
+        tracked::moves = 0;
+        return result;
+    }
+};
+
+// GIVEN: A zip of containers referenced by the zip
+// WHEN: It's unzipped
+// THEN: A vector must be returned for each column, with copies of the elements up to the shortest container
+TEST_F(UnzipTest, UnzipsZip)
+{
+    auto [ids, names] = msd::unzip(msd::zip(ids_, names_));
+
+    static_assert(std::is_same_v<decltype(ids), std::vector<int>>);
+    static_assert(std::is_same_v<decltype(names), std::vector<std::string>>);
+    EXPECT_EQ(ids, ids_);
+    EXPECT_EQ(names, (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(names_, (std::vector<std::string>{"a", "b", "c", "d"}));
+}
+
+// GIVEN: Containers of tuples, pairs and arrays, some of them constant
+// WHEN: They are unzipped
+// THEN: Their elements must be split into columns
+TEST_F(UnzipTest, UnzipsTupleLikeRows)
+{
+    const std::list<std::pair<int, char>> pairs{{1, 'x'}, {2, 'y'}};
+    const auto [numbers, letters] = msd::unzip(pairs);
+    EXPECT_EQ(numbers, (std::vector<int>{1, 2}));
+    EXPECT_EQ(letters, (std::vector<char>{'x', 'y'}));
+
+    const std::vector<std::array<double, 3>> points{{1, 2, 3}, {4, 5, 6}};
+    const auto [xs, ys, zs] = msd::unzip(points);
+    EXPECT_EQ(xs, (std::vector<double>{1, 4}));
+    EXPECT_EQ(ys, (std::vector<double>{2, 5}));
+    EXPECT_EQ(zs, (std::vector<double>{3, 6}));
+
+    const auto empty = msd::unzip(std::vector<std::tuple<int, bool>>{});
+    EXPECT_TRUE(std::get<0>(empty).empty());
+    EXPECT_TRUE(std::get<1>(empty).empty());
+}
+
+// GIVEN: Containers of rows given as lvalues and rvalues
+// WHEN: They are unzipped
+// THEN: Elements of lvalues must be copied and elements of rvalues must be moved, without other copies or moves
+TEST_F(UnzipTest, MovesElementsOfRvalueRanges)
+{
+    std::vector<std::tuple<tracked, int>> rows;
+    rows.emplace_back(tracked{1}, 10);
+    rows.emplace_back(tracked{2}, 20);
+    tracked::copies = 0;
+    tracked::moves = 0;
+
+    const auto copied = msd::unzip(rows);
+    EXPECT_EQ(tracked::copies, 2);
+    EXPECT_EQ(tracked::moves, 0);
+
+    tracked::copies = 0;
+    const auto moved = msd::unzip(std::move(rows));
+    EXPECT_EQ(tracked::copies, 0);
+    EXPECT_EQ(tracked::moves, 2);
+    EXPECT_EQ(std::get<0>(moved), std::get<0>(copied));
+    EXPECT_EQ(std::get<1>(moved), (std::vector<int>{10, 20}));
+}
+
+// GIVEN: A zip owning a container and referencing another one
+// WHEN: It's unzipped as an rvalue
+// THEN: The elements of the owned container must be moved and the elements of the referenced one copied
+TEST_F(UnzipTest, MovesElementsOwnedByZip)
+{
+    auto owned = make_tracked({1, 2, 3});
+    const auto referenced = make_tracked({4, 5, 6});
+
+    auto [first, second] = msd::unzip(msd::zip(std::move(owned), referenced));
+    EXPECT_EQ(tracked::copies, 3);
+    EXPECT_EQ(tracked::moves, 3);
+    EXPECT_EQ(second, referenced);
+    EXPECT_EQ(first, make_tracked({1, 2, 3}));
+
+    msd::zip zip(make_tracked({7, 8}), referenced);
+    std::vector<tracked> sevens;
+    std::vector<tracked> fours;
+    msd::unzip_into(zip, sevens, fours);
+    EXPECT_EQ(tracked::copies, 4);
+    EXPECT_EQ(tracked::moves, 0);
+    EXPECT_EQ(std::get<0>(*zip.begin()).value(), 7);
+}
+
+// GIVEN: An rvalue zip owning a view over strings
+// WHEN: It's unzipped
+// THEN: The strings must be copied and the container viewed must not change
+TEST_F(UnzipTest, CopiesElementsOfViewsOwnedByZip)
+{
+    const std::vector<std::string> original{"first string", "second string"};
+    auto strings = original;
+
+    auto [copied, ids] = msd::unzip(msd::zip(msd::iterator_range(strings.begin(), strings.end()), ids_));
+    EXPECT_EQ(copied, original);
+    EXPECT_EQ(ids, (std::vector<int>{1, 2}));
+    EXPECT_EQ(strings, original);
+
+    const auto rows = msd::to_rows(msd::zip(strings | msd::take(1), std::vector<int>{7}));
+    EXPECT_EQ(rows.front(), std::make_tuple(original.front(), 7));
+    EXPECT_EQ(strings, original);
+}
+
+// GIVEN: A range whose rows are rvalues
+// WHEN: It's unzipped
+// THEN: The elements of the rows must be moved
+TEST_F(UnzipTest, MovesElementsOfRvalueRows)
+{
+    std::vector<std::tuple<tracked>> rows;
+    rows.emplace_back(tracked{1});
+    tracked::moves = 0;
+
+    auto [values] = msd::unzip(msd::iterator_range(std::make_move_iterator(rows.begin()),
+                                                   std::make_move_iterator(rows.end())));
+    EXPECT_EQ(tracked::copies, 0);
+    EXPECT_EQ(tracked::moves, 1);
+    EXPECT_EQ(values, make_tracked({1}));
+}
+
+// GIVEN: Rvalue views over containers of rows, which don't own the rows
+// WHEN: They are unzipped
+// THEN: The elements must be copied and the containers must not change
+TEST_F(UnzipTest, CopiesElementsOfRvalueViews)
+{
+    std::vector<std::tuple<tracked, int>> rows;
+    rows.emplace_back(tracked{1}, 10);
+    rows.emplace_back(tracked{2}, 20);
+    rows.emplace_back(tracked{3}, 30);
+    const auto original = rows;
+    tracked::copies = 0;
+    tracked::moves = 0;
+
+    const auto [all, all_numbers] = msd::unzip(msd::iterator_range(rows.begin(), rows.end()));
+    EXPECT_EQ(tracked::copies, 3);
+    EXPECT_EQ(tracked::moves, 0);
+    EXPECT_EQ(all_numbers, (std::vector<int>{10, 20, 30}));
+    EXPECT_EQ(rows, original);
+
+    const auto [first, first_numbers] = msd::unzip(rows | msd::take(2));
+    EXPECT_EQ(tracked::copies, 5);
+    EXPECT_EQ(tracked::moves, 0);
+    EXPECT_EQ(first, (std::vector<tracked>{tracked{1}, tracked{2}}));
+    EXPECT_EQ(rows, original);
+
+    const auto tuples = msd::to_rows(rows | msd::take(1));
+    EXPECT_EQ(tuples.front(), original.front());
+    EXPECT_EQ(rows, original);
+}
+
+// GIVEN: Outputs which already have elements and a range of known size
+// WHEN: The range is unzipped into them
+// THEN: Memory must be reserved once for all appended elements and the elements must be appended
+TEST_F(UnzipTest, UnzipIntoReservesAndAppends)
+{
+    recording_output ids;
+    ids.values = {0};
+    std::list<std::string> names{"z"};
+
+    msd::unzip_into(msd::zip(ids_, names_), ids, names);
+
+    EXPECT_EQ(ids.reserves, (std::vector<std::size_t>{4}));
+    EXPECT_EQ(ids.values, (std::vector<int>{0, 1, 2, 3}));
+    EXPECT_EQ(names, (std::list<std::string>{"z", "a", "b", "c"}));
+}
+
+// GIVEN: A single pass range of unknown size
+// WHEN: It's unzipped
+// THEN: The range must be read once, without reserving memory
+TEST_F(UnzipTest, UnzipsSinglePassRange)
+{
+    std::istringstream numbers{"1 2 3"};
+    std::istringstream words{"one two three four"};
+    msd::streaming_zip zip(msd::iterator_range(std::istream_iterator<int>{numbers}, std::istream_iterator<int>{}),
+                           msd::iterator_range(std::istream_iterator<std::string>{words}, {}));
+
+    recording_output first;
+    std::vector<std::string> second;
+    msd::unzip_into(zip, first, second);
+
+    EXPECT_TRUE(first.reserves.empty());
+    EXPECT_EQ(first.values, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(second, (std::vector<std::string>{"one", "two", "three"}));
+}
+
+// GIVEN: A zip
+// WHEN: It's copied into rows
+// THEN: The rows must be tuples of values by default, or the given row type built from the elements
+TEST_F(UnzipTest, ToRows)
+{
+    const auto tuples = msd::to_rows(msd::zip(ids_, names_));
+    static_assert(std::is_same_v<decltype(tuples), const std::vector<std::tuple<int, std::string>>>);
+    EXPECT_EQ(tuples, (std::vector<std::tuple<int, std::string>>{{1, "a"}, {2, "b"}, {3, "c"}}));
+    EXPECT_EQ(tuples.capacity(), 3);
+
+    class quote {
+       public:
+        int id;
+        std::string name;
+    };
+
+    const auto quotes = msd::to_rows<quote>(msd::zip(ids_, names_));
+    ASSERT_EQ(quotes.size(), 3);
+    EXPECT_EQ(quotes[2].id, 3);
+    EXPECT_EQ(quotes[2].name, "c");
+
+    const auto pairs = msd::to_rows<std::pair<std::string, int>>(msd::zip(names_, ids_));
+    EXPECT_EQ(pairs.front(), std::make_pair(std::string{"a"}, 1));
+}
+
+// GIVEN: A zip owning a container and referencing another one
+// WHEN: It's copied into rows as an rvalue
+// THEN: The elements of the owned container must be moved and the elements of the referenced one copied
+TEST_F(UnzipTest, ToRowsMovesOwnedElements)
+{
+    const auto referenced = make_tracked({4, 5});
+
+    const auto rows = msd::to_rows(msd::zip(make_tracked({1, 2}), referenced));
+    ASSERT_EQ(rows.size(), 2);
+    EXPECT_EQ(std::get<0>(rows[1]).value(), 2);
+    EXPECT_EQ(std::get<1>(rows[1]).value(), 5);
+
+    // Each owned element is moved into a row, each referenced one is copied; building the rows moves both.
+    EXPECT_EQ(tracked::copies, 2);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <vector>
+
+#include "msd/zip.hpp"
+
+class ZipChunksTest : public testing::Test {
+   protected:
+    std::vector<int> vector_ = std::vector<int>(10);
+    std::vector<int> other_vector_ = std::vector<int>(12);
+    std::list<int> list_ = std::list<int>(11);
+
+    void SetUp() override
+    {
+        std::iota(vector_.begin(), vector_.end(), 0);
+        std::iota(other_vector_.begin(), other_vector_.end(), 100);
+        std::iota(list_.begin(), list_.end(), 200);
+    }
+};
+
+// GIVEN: Random access containers zipped together
+// WHEN: The zip is split into chunks
+// THEN: The chunks must cover the zipped sequence, in order, each having at most the given size
+TEST_F(ZipChunksTest, RandomAccessContainers)
+{
+    const msd::zip zip(vector_, other_vector_);
+    const auto chunks = zip.chunks(4);
+
+    EXPECT_EQ(chunks.size(), 3);
+    EXPECT_FALSE(chunks.empty());
+
+    std::vector<std::size_t> sizes;
+    int expected = 0;
+    for (auto chunk : chunks) {
+        sizes.push_back(chunk.size());
+        for (auto [a, b] : chunk) {
+            EXPECT_EQ(a, expected);
+            EXPECT_EQ(b, expected + 100);
+            ++expected;
+        }
+    }
+
+    EXPECT_EQ(sizes, (std::vector<std::size_t>{4, 4, 2}));
+    EXPECT_EQ(expected, 10);
+}
+
+// GIVEN: Non random access containers zipped together
+// WHEN: The zip is split into chunks
+// THEN: The chunks must cover the zipped sequence, in order, each having at most the given size
+TEST_F(ZipChunksTest, NonRandomAccessContainers)
+{
+    const msd::zip zip(list_, other_vector_);
+    const auto chunks = zip.chunks(5);
+
+    EXPECT_EQ(chunks.size(), 3);
+    EXPECT_EQ(std::distance(chunks.begin(), chunks.end()), 3);
+
+    std::vector<std::size_t> sizes;
+    int expected = 0;
+    for (auto chunk : chunks) {
+        sizes.push_back(chunk.size());
+        for (auto [a, b] : chunk) {
+            EXPECT_EQ(a, expected + 200);
+            EXPECT_EQ(b, expected + 100);
+            ++expected;
+        }
+    }
+
+    EXPECT_EQ(sizes, (std::vector<std::size_t>{5, 5, 1}));
+    EXPECT_EQ(expected, 11);
+}
+
+// GIVEN: A zip whose size is a multiple of the chunk size, and a chunk size larger than the zip
+// WHEN: The zip is split into chunks
+// THEN: All chunks must be full, or a single chunk must hold the whole zip
+TEST_F(ZipChunksTest, ChunkSizes)
+{
+    const msd::zip zip(vector_, other_vector_);
+
+    const auto exact_chunks = zip.chunks(5);
+    EXPECT_EQ(exact_chunks.size(), 2);
+    for (auto chunk : exact_chunks) {
+        EXPECT_EQ(chunk.size(), 5);
+    }
+
+    const auto large_chunks = zip.chunks(100);
+    EXPECT_EQ(large_chunks.size(), 1);
+    EXPECT_EQ((*large_chunks.begin()).size(), 10);
+}
+
+// GIVEN: A zip and chunk sizes out of the range of the iterator difference (zero and larger than PTRDIFF_MAX)
+// WHEN: The zip is split into chunks
+// THEN: Zero must be taken as one and larger sizes must be clamped, so the chunks always move forward
+TEST_F(ZipChunksTest, OutOfRangeChunkSizes)
+{
+    const msd::zip zip(vector_, list_);
+
+    const auto single_chunks = zip.chunks(0);
+    EXPECT_EQ(single_chunks.size(), 10);
+    EXPECT_EQ(std::distance(single_chunks.begin(), single_chunks.end()), 10);
+
+    for (const auto size : {static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()) + 1,
+                            std::numeric_limits<std::size_t>::max()}) {
+        const auto chunks = zip.chunks(size);
+        EXPECT_EQ(chunks.size(), 1);
+        ASSERT_EQ(std::distance(chunks.begin(), chunks.end()), 1);
+        EXPECT_EQ((*chunks.begin()).size(), 10);
+    }
+
+    const msd::zip random_access(vector_, other_vector_);
+    const auto chunks = random_access.chunks(std::numeric_limits<std::size_t>::max());
+    ASSERT_EQ(chunks.size(), 1);
+    EXPECT_EQ((*chunks.begin()).end(), random_access.end());
+}
+
+// GIVEN: An empty zip
+// WHEN: The zip is split into chunks
+// THEN: There must be no chunks
+TEST_F(ZipChunksTest, EmptyZip)
+{
+    std::vector<int> empty;
+    const msd::zip zip(vector_, empty);
+    const auto chunks = zip.chunks(3);
+
+    EXPECT_TRUE(chunks.empty());
+    EXPECT_EQ(chunks.size(), 0);
+    EXPECT_EQ(chunks.begin(), chunks.end());
+}
+
+// GIVEN: A chunk of a zip
+// WHEN: The elements of the chunk are accessed and modified
+// THEN: The changes must be reflected in the containers
+TEST_F(ZipChunksTest, ChunkAccess)
+{
+    msd::zip zip(vector_, list_);
+    auto iterator = zip.chunks(4).begin();
+    ++iterator;
+    const auto chunk = *iterator;
+
+    auto [a, b] = chunk.front();
+    EXPECT_EQ(a, 4);
+    EXPECT_EQ(b, 204);
+
+    auto [c, d] = chunk[3];
+    EXPECT_EQ(c, 7);
+    EXPECT_EQ(d, 207);
+
+    for (auto [x, y] : chunk) {
+        x = -y;
+    }
+    EXPECT_EQ(vector_[5], -205);
+    EXPECT_EQ(vector_[8], 8);
+
+    EXPECT_DEBUG_DEATH(chunk[4], "");
+}
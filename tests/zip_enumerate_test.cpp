@@ -0,0 +1,99 @@
+#include "msd/zip_enumerate.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "msd/zip.hpp"
+
+class ZipEnumerateTest : public testing::Test {
+   protected:
+    std::vector<int> vector_{10, 20, 30, 40};
+    std::list<char> list_{'a', 'b', 'c'};
+};
+
+// GIVEN: Containers of different lengths
+// WHEN: They are enumerated
+// THEN: Each row must start with its index, and the iteration must stop at the shortest container
+TEST_F(ZipEnumerateTest, EnumerateZip)
+{
+    std::vector<std::tuple<std::size_t, int, char>> rows;
+    for (auto [index, number, letter] : msd::enumerate_zip(vector_, list_)) {
+        rows.emplace_back(index, number, letter);
+    }
+
+    const std::vector<std::tuple<std::size_t, int, char>> expected{{0, 10, 'a'}, {1, 20, 'b'}, {2, 30, 'c'}};
+    EXPECT_EQ(rows, expected);
+
+    for (auto [index, number] : msd::enumerate_zip(vector_)) {
+        number = static_cast<int>(index);
+    }
+    EXPECT_EQ(vector_, (std::vector<int>{0, 1, 2, 3}));
+}
+
+// GIVEN: An iota and contiguous containers
+// WHEN: They are zipped
+// THEN: The zip must use a single offset, computing the indices from it, and support random access, without the iota
+// being taken for contiguous storage
+TEST_F(ZipEnumerateTest, IotaColumnWithContiguousContainers)
+{
+    static_assert(!msd::detail::is_contiguous<msd::iota>::value);
+    static_assert(msd::detail::has_offset_base<msd::iota>::value);
+
+    const msd::zip zip(msd::iota{5, 100}, vector_);
+    static_assert(std::is_same_v<decltype(zip)::iterator, msd::offset_zip_iterator<msd::iota::iterator, int*>>);
+    static_assert(std::is_same_v<decltype(zip)::reference, msd::zip_reference<std::size_t, int&>>);
+
+    EXPECT_EQ(zip.size(), 4);
+    EXPECT_EQ(std::get<0>(zip[2]), 7);
+    EXPECT_EQ(std::get<0>(zip.back()), 8);
+    EXPECT_EQ(std::get<0>(*(zip.end() - 3)), 6);
+
+    const auto found = std::find_if(zip.begin(), zip.end(), [](auto row) { return std::get<1>(row) == 30; });
+    EXPECT_EQ(std::get<0>(*found), 7);
+}
+
+// GIVEN: A bounded iota shorter than the other container
+// WHEN: They are zipped
+// THEN: The iteration must stop at the end of the iota
+TEST_F(ZipEnumerateTest, BoundedIota)
+{
+    std::size_t sum = 0;
+    for (auto [index, letter] : msd::zip(msd::iota{2}, list_)) {
+        sum += index;
+        EXPECT_NE(letter, 'c');
+    }
+    EXPECT_EQ(sum, 1);
+
+    EXPECT_TRUE(msd::iota(3, 3).empty());
+    EXPECT_EQ(msd::iota(3, 7).size(), 4);
+    EXPECT_EQ(std::distance(msd::iota(3, 7).begin(), msd::iota(3, 7).end()), 4);
+}
+
+// GIVEN: An iota and an array
+// WHEN: They are used in a constant expression
+// THEN: The indices must be computed at compile time
+TEST_F(ZipEnumerateTest, ConstantExpressions)
+{
+    constexpr auto weighted_sum = [] {
+        const std::array<int, 3> values{3, 5, 7};
+        const msd::iota indices;
+        std::size_t sum = 0;
+        for (auto [index, value] : msd::zip(indices, values)) {
+            sum += index * static_cast<std::size_t>(value);
+        }
+        return sum;
+    }();
+    static_assert(weighted_sum == 5 + 14);
+
+    static_assert(std::is_trivially_copyable_v<msd::iota::iterator>);
+    static_assert(std::is_same_v<std::iterator_traits<msd::iota::iterator>::iterator_category,
+                                 std::random_access_iterator_tag>);
+}
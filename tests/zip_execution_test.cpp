@@ -0,0 +1,117 @@
+#if __has_include(<execution>)
+#include <execution>
+#endif
+
+#if defined(__cpp_lib_execution)
+
+#include "msd/zip_execution.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+class ZipExecutionTest : public testing::Test {
+   protected:
+    static constexpr std::size_t kSize = 100'000;
+
+    std::vector<long> first_ = std::vector<long>(kSize, 1);
+    std::vector<long> second_ = std::vector<long>(kSize, 2);
+    std::vector<long> third_ = std::vector<long>(kSize + 1, 3);
+
+    void SetUp() override
+    {
+        std::iota(first_.begin(), first_.end(), 0);
+        std::iota(second_.begin(), second_.end(), 0);
+    }
+};
+
+// GIVEN: Random access containers zipped together
+// WHEN: for_each is called with parallel policies
+// THEN: The function must be applied to each tuple of elements
+TEST_F(ZipExecutionTest, ForEach)
+{
+    msd::for_each(std::execution::par_unseq, msd::zip(first_, second_, third_), [](auto tuple) {
+        auto [a, b, c] = tuple;
+        a = b * c;
+    });
+
+    for (std::size_t i = 0; i < kSize; ++i) {
+        EXPECT_EQ(first_[i], static_cast<long>(i) * 3);
+    }
+
+    msd::for_each(std::execution::seq, msd::zip(first_, second_), [](auto tuple) { std::get<0>(tuple) = 0; });
+    EXPECT_EQ(std::accumulate(first_.begin(), first_.end(), 0L), 0);
+}
+
+// GIVEN: Random access containers zipped together
+// WHEN: transform is called with a parallel policy
+// THEN: The output must hold the transformation of each tuple of elements
+TEST_F(ZipExecutionTest, Transform)
+{
+    std::vector<long> output(kSize);
+
+    const auto end = msd::transform(std::execution::par, msd::zip(first_, second_, third_), output.begin(),
+                                    [](auto tuple) {
+                                        auto [a, b, c] = tuple;
+                                        return a + b + c;
+                                    });
+
+    EXPECT_EQ(end, output.end());
+    for (std::size_t i = 0; i < kSize; ++i) {
+        EXPECT_EQ(output[i], static_cast<long>(i) * 2 + 3);
+    }
+}
+
+// GIVEN: Random access containers zipped together
+// WHEN: reduce is called with a parallel policy
+// THEN: The result must be the reduction of all tuples of elements
+TEST_F(ZipExecutionTest, Reduce)
+{
+    class sum_of_products {
+       public:
+        long operator()(long acc, long value) const { return acc + value; }
+        long operator()(long acc, std::tuple<long&, long&> tuple) const { return acc + value(tuple); }
+        long operator()(std::tuple<long&, long&> tuple, long acc) const { return acc + value(tuple); }
+        long operator()(std::tuple<long&, long&> lhs, std::tuple<long&, long&> rhs) const
+        {
+            return value(lhs) + value(rhs);
+        }
+
+        static long value(std::tuple<long&, long&> tuple) { return std::get<0>(tuple) * std::get<1>(tuple); }
+    };
+
+    const auto result = msd::reduce(std::execution::par, msd::zip(first_, second_), 0L, sum_of_products{});
+
+    EXPECT_EQ(result, std::inner_product(first_.begin(), first_.end(), second_.begin(), 0L));
+}
+
+// GIVEN: Random access containers zipped together
+// WHEN: transform_reduce is called with a parallel policy
+// THEN: The result must be the reduction of the transformed tuples of elements
+TEST_F(ZipExecutionTest, TransformReduce)
+{
+    const auto dot = msd::transform_reduce(std::execution::par_unseq, msd::zip(first_, second_), 0L, std::plus<>{},
+                                           [](auto tuple) { return std::get<0>(tuple) * std::get<1>(tuple); });
+
+    EXPECT_EQ(dot, std::inner_product(first_.begin(), first_.end(), second_.begin(), 0L));
+}
+
+// GIVEN: Non random access containers zipped together
+// WHEN: The algorithms are called with a parallel policy
+// THEN: The results must be correct, even if the execution is sequential
+TEST_F(ZipExecutionTest, NonRandomAccessContainers)
+{
+    std::list<long> list(first_.begin(), first_.end());
+
+    const auto sum = msd::transform_reduce(std::execution::par, msd::zip(list, second_), 0L, std::plus<>{},
+                                           [](auto tuple) { return std::get<0>(tuple) + std::get<1>(tuple); });
+
+    EXPECT_EQ(sum, static_cast<long>(kSize * (kSize - 1)));
+}
+
+#endif
@@ -2,20 +2,49 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <deque>
 #include <forward_list>
+#include <functional>
 #include <iterator>
 #include <list>
 #include <map>
 #include <numeric>
 #include <set>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "msd/zip.hpp"
 
+/**
+ * @brief A value counting how many times values were copied.
+ */
+class copy_counted {
+   public:
+    static inline int copies = 0;
+
+    explicit copy_counted(const int value) : value_{value} {}
+    copy_counted(const copy_counted& other) : value_{other.value_} { ++copies; }
+    copy_counted(copy_counted&&) noexcept = default;
+    copy_counted& operator=(const copy_counted& other)
+    {
+        value_ = other.value_;
+        ++copies;
+        return *this;
+    }
+    copy_counted& operator=(copy_counted&&) noexcept = default;
+    ~copy_counted() = default;
+
+    [[nodiscard]] int value() const { return value_; }
+
+   private:
+    int value_;
+};
+
 class ZipIntegrationTest : public testing::Test {
    protected:
     std::vector<int> vector_{1, 0};
@@ -117,3 +146,148 @@ TEST_F(ZipIntegrationTest, ClassicalIterations)
     }
     EXPECT_EQ(iterations, 0);
 }
+
+// GIVEN: Random access containers
+// WHEN: They are zipped together and std algorithms requiring random access iterators are used
+// THEN: The zip must integrate well with the algorithms
+TEST_F(ZipIntegrationTest, RandomAccessContainersAndAlgorithms)
+{
+    const std::vector<int> keys{1, 3, 5, 7, 9};
+    const msd::zip zip(keys, array_, deque_, string_);
+
+    static_assert(std::is_same_v<decltype(zip)::iterator::iterator_category, std::random_access_iterator_tag>);
+
+    EXPECT_EQ(std::distance(zip.begin(), zip.end()), 2);
+    EXPECT_EQ(zip.end() - zip.begin(), 2);
+
+    const msd::zip sorted(keys, array_);
+    const auto iterator = std::lower_bound(sorted.begin(), sorted.end(), 5,
+                                           [](auto&& tuple, const int key) { return std::get<0>(tuple) < key; });
+
+    ASSERT_NE(iterator, sorted.end());
+    EXPECT_EQ(iterator - sorted.begin(), 2);
+    EXPECT_EQ(std::get<1>(*iterator), 3);
+
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end(), [](auto&& lhs, auto&& rhs) { return lhs < rhs; }));
+}
+
+// GIVEN: C arrays, string views and ranges over raw memory
+// WHEN: They are zipped together
+// THEN: The zip must iterate over them without copying
+TEST_F(ZipIntegrationTest, ArraysViewsAndRawMemory)
+{
+    int c_array[] = {1, 2, 3, 4};
+    const double const_c_array[] = {0.5, 1.5, 2.5};
+    const std::string_view string_view{"abcde"};
+    const auto raw = msd::ptr_range(vector_.data(), vector_.size());
+
+    msd::zip zip(c_array, const_c_array, string_view, raw);
+    static_assert(std::is_same_v<decltype(zip)::reference,
+                                 msd::zip_reference<int&, const double&, const char&, int&>>);
+    static_assert(std::is_same_v<decltype(zip)::iterator,
+                                 msd::offset_zip_iterator<int*, const double*, const char*, int*>>);
+
+    EXPECT_EQ(zip.size(), 2);
+
+    for (auto [a, b, c, d] : zip) {
+        a = static_cast<int>(b * 2) + c + d;
+    }
+    EXPECT_EQ(c_array[0], 1 + 'a' + 1);
+    EXPECT_EQ(c_array[1], 3 + 'b' + 0);
+    EXPECT_EQ(c_array[2], 3);
+
+    auto [ra, rb, rc, rd] = zip.back();
+    EXPECT_EQ(&ra, &c_array[1]);
+    EXPECT_EQ(&rb, &const_c_array[1]);
+    EXPECT_EQ(&rc, &string_view[1]);
+    EXPECT_EQ(&rd, &vector_[1]);
+}
+
+// GIVEN: Ranges between pairs of iterators
+// WHEN: They are zipped together
+// THEN: The zip must iterate over the elements between the iterators
+TEST_F(ZipIntegrationTest, IteratorRanges)
+{
+    const msd::iterator_range list_range(std::next(list_.begin()), list_.end());
+    const msd::iterator_range set_range(set_.begin(), std::next(set_.begin(), 4));
+
+    EXPECT_EQ(list_range.size(), 2);
+    EXPECT_FALSE(list_range.empty());
+
+    std::vector<int> sums;
+    for (auto [a, b] : msd::zip(list_range, set_range)) {
+        sums.push_back(a + b);
+    }
+    EXPECT_EQ(sums, (std::vector<int>{3, 5}));
+
+    const auto empty = msd::ptr_range(array_.data(), 0);
+    EXPECT_TRUE(msd::zip(empty, list_range).empty());
+}
+
+// GIVEN: Random access containers holding the columns of a table
+// WHEN: The zipped rows are sorted by one of the columns
+// THEN: All columns must be permuted together
+TEST_F(ZipIntegrationTest, SortPermutesAllContainers)
+{
+    std::vector<int> keys{3, 1, 4, 2, 5, 0};
+    std::deque<std::string> names{"d", "b", "e", "c", "f", "a"};
+    std::array<double, 6> weights{3.5, 1.5, 4.5, 2.5, 5.5, 0.5};
+
+    msd::zip zip(keys, names, weights);
+    std::sort(zip.begin(), zip.end(), msd::by<0>());
+
+    EXPECT_EQ(keys, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(names, (std::deque<std::string>{"a", "b", "c", "d", "e", "f"}));
+    EXPECT_EQ(weights, (std::array<double, 6>{0.5, 1.5, 2.5, 3.5, 4.5, 5.5}));
+
+    std::stable_sort(zip.begin(), zip.end(), msd::by<1>(std::greater<>{}));
+    EXPECT_EQ(keys, (std::vector<int>{5, 4, 3, 2, 1, 0}));
+    EXPECT_EQ(weights, (std::array<double, 6>{5.5, 4.5, 3.5, 2.5, 1.5, 0.5}));
+
+    std::reverse(zip.begin(), zip.end());
+    EXPECT_EQ(names, (std::deque<std::string>{"a", "b", "c", "d", "e", "f"}));
+
+    std::iter_swap(zip.begin(), std::next(zip.begin()));
+    EXPECT_EQ(keys.front(), 1);
+    EXPECT_EQ(names.front(), "b");
+    EXPECT_EQ(weights.front(), 1.5);
+}
+
+// GIVEN: Containers holding the columns of a table, one of them with values which count their copies
+// WHEN: The zipped rows are sorted with msd::sort
+// THEN: All containers must be permuted together by moving the values, without copying them
+TEST_F(ZipIntegrationTest, SortMovesElements)
+{
+    std::vector<int> keys{3, 1, 4, 2, 5, 0, 6};
+    std::vector<copy_counted> values;
+    for (const auto key : keys) {
+        values.emplace_back(key * 10);
+    }
+    std::deque<std::string> names{"d", "b", "e", "c", "f", "a", "g"};
+    copy_counted::copies = 0;
+
+    msd::zip zip(keys, values, names);
+    msd::sort(zip.begin(), zip.end(), msd::by<0>());
+
+    EXPECT_EQ(copy_counted::copies, 0);
+    EXPECT_EQ(keys, (std::vector<int>{0, 1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(names, (std::deque<std::string>{"a", "b", "c", "d", "e", "f", "g"}));
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(values[i].value(), keys[i] * 10);
+    }
+
+    msd::sort(zip.begin(), zip.end(), msd::by<2>(std::greater<>{}));
+    EXPECT_EQ(copy_counted::copies, 0);
+    EXPECT_EQ(keys, (std::vector<int>{6, 5, 4, 3, 2, 1, 0}));
+    EXPECT_EQ(values.back().value(), 0);
+
+    std::vector<int> numbers{2, 3, 1};
+    std::array<double, 3> reals{2.5, 3.5, 1.5};
+    msd::zip trivial(numbers, reals);
+    msd::sort(trivial.begin(), trivial.end());
+    EXPECT_EQ(numbers, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(reals, (std::array<double, 3>{1.5, 2.5, 3.5}));
+
+    msd::sort(numbers.begin(), numbers.end(), std::greater<>{});
+    EXPECT_EQ(numbers, (std::vector<int>{3, 2, 1}));
+}
@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <forward_list>
 #include <iterator>
+#include <list>
+#include <string>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -26,23 +30,23 @@ class ZipIteratorTest : public testing::Test {
 
 // GIVEN: A zip_iterator object is created with the beginning of three containers
 // WHEN: Iterator traits are verified
-// THEN: The traits should match the expected values for a bidirectional iterator with the appropriate types for value,
+// THEN: The traits should match the expected values for a random access iterator with the appropriate types for value,
 // pointer, and reference
 TEST_F(ZipIteratorTest, IteratorTraits)
 {
     using iterator_type = decltype(begin_iterator_);
 
-    static_assert(std::is_same_v<iterator_type::iterator_category, std::bidirectional_iterator_tag>);
+    static_assert(std::is_same_v<iterator_type::iterator_category, std::random_access_iterator_tag>);
     static_assert(std::is_same_v<iterator_type::difference_type, std::ptrdiff_t>);
     static_assert(std::is_same_v<iterator_type::value_type,
-                                 std::tuple<arr_three_type::const_reference, vector_two_type::reference,
-                                            vector_four_type::const_reference>>);
+                                 std::tuple<arr_three_type::value_type, vector_two_type::value_type,
+                                            vector_four_type::value_type>>);
     static_assert(
         std::is_same_v<iterator_type::pointer, std::tuple<arr_three_type::const_pointer, vector_two_type::pointer,
                                                           vector_four_type::const_pointer>>);
-    static_assert(
-        std::is_same_v<iterator_type::reference, std::tuple<arr_three_type::const_reference, vector_two_type::reference,
-                                                            vector_four_type::const_reference>>);
+    static_assert(std::is_same_v<iterator_type::reference,
+                                 msd::zip_reference<arr_three_type::const_reference, vector_two_type::reference,
+                                                    vector_four_type::const_reference>>);
 }
 
 // GIVEN: A zip_iterator object is created with the beginning of three containers
@@ -166,12 +170,15 @@ TEST_F(ZipIteratorTest, OperatorMinus)
     EXPECT_EQ(begin, begin_iterator_);
 }
 
-// GIVEN: A zip_iterator object and another iterator (as offset)
+// GIVEN: Two zip_iterator objects
 // WHEN: The iterator minus another iterator is computed
-// THEN: The result should match the beginning iterator if the offset covers the entire length
+// THEN: The result should be the shortest distance between the zipped iterators
 TEST_F(ZipIteratorTest, OperatorMinusIterator)
 {
-    EXPECT_EQ(end_iterator_ - std::prev(end_iterator_, 2), begin_iterator_);
+    EXPECT_EQ(end_iterator_ - begin_iterator_, 2);
+    EXPECT_EQ(begin_iterator_ - end_iterator_, -2);
+    EXPECT_EQ(end_iterator_ - std::prev(end_iterator_, 2), 2);
+    EXPECT_EQ(begin_iterator_ - begin_iterator_, 0);
 }
 
 // GIVEN: A zip_iterator object pointing to the end of the containers
@@ -198,3 +205,205 @@ TEST_F(ZipIteratorTest, Advance)
 // WHEN: std::distance is used to compute the distance between the two iterators
 // THEN: The distance should match the expected number of elements between the iterators
 TEST_F(ZipIteratorTest, Distance) { EXPECT_EQ(std::distance(begin_iterator_, end_iterator_), 2); }
+
+// GIVEN: Iterators of different categories
+// WHEN: They are zipped together
+// THEN: The category of the zip_iterator should be the weakest one
+TEST_F(ZipIteratorTest, IteratorCategoryIsTheWeakest)
+{
+    using random_access = std::vector<int>::iterator;
+    using bidirectional = std::list<int>::iterator;
+    using forward = std::forward_list<int>::iterator;
+
+    static_assert(std::is_same_v<msd::zip_iterator<random_access, random_access>::iterator_category,
+                                 std::random_access_iterator_tag>);
+    static_assert(std::is_same_v<msd::zip_iterator<random_access, bidirectional>::iterator_category,
+                                 std::bidirectional_iterator_tag>);
+    static_assert(std::is_same_v<msd::zip_iterator<random_access, bidirectional, forward>::iterator_category,
+                                 std::forward_iterator_tag>);
+}
+
+// GIVEN: A zip_iterator object pointing to the beginning of the containers
+// WHEN: The post-increment and post-decrement operators are used
+// THEN: The iterator should be moved and its previous position returned
+TEST_F(ZipIteratorTest, OperatorPostIncrementAndPostDecrement)
+{
+    auto iterator = begin_iterator_;
+
+    EXPECT_EQ(iterator++, begin_iterator_);
+    EXPECT_EQ(iterator, begin_iterator_ + 1);
+
+    EXPECT_EQ(iterator--, begin_iterator_ + 1);
+    EXPECT_EQ(iterator, begin_iterator_);
+}
+
+// GIVEN: A zip_iterator object pointing to the beginning of the containers
+// WHEN: The compound assignment operators (+=, -=) are used
+// THEN: The iterator should be moved in place by the specified offset
+TEST_F(ZipIteratorTest, OperatorCompoundAssignment)
+{
+    auto iterator = begin_iterator_;
+
+    iterator += 2;
+    EXPECT_EQ(iterator, end_iterator_);
+
+    iterator -= 1;
+    auto [a, b, c] = *iterator;
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 5);
+    EXPECT_EQ(c, 7);
+
+    EXPECT_EQ(1 + begin_iterator_, iterator);
+}
+
+// GIVEN: A zip_iterator object pointing to the beginning of the containers
+// WHEN: The subscript operator ([]) is used
+// THEN: The elements at the specified offset should be returned
+TEST_F(ZipIteratorTest, OperatorSubscript)
+{
+    auto [a, b, c] = begin_iterator_[1];
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 5);
+    EXPECT_EQ(c, 7);
+
+    auto [ea, eb, ec] = end_iterator_[-1];
+    EXPECT_EQ(ea, 3);
+    EXPECT_EQ(eb, 5);
+    EXPECT_EQ(ec, 9);
+}
+
+// GIVEN: zip_iterator objects pointing to different positions
+// WHEN: The relational operators (<, <=, >, >=) are used
+// THEN: The iterators should be ordered by their positions
+TEST_F(ZipIteratorTest, RelationalOperators)
+{
+    const auto middle = begin_iterator_ + 1;
+
+    EXPECT_LT(begin_iterator_, middle);
+    EXPECT_LE(begin_iterator_, middle);
+    EXPECT_LE(begin_iterator_, begin_iterator_);
+    EXPECT_GT(end_iterator_, middle);
+    EXPECT_GE(end_iterator_, middle);
+    EXPECT_GE(middle, middle);
+
+    EXPECT_FALSE(middle < middle);
+    EXPECT_FALSE(middle > middle);
+    EXPECT_FALSE(end_iterator_ < begin_iterator_);
+}
+
+// GIVEN: zip_iterator objects over a list and a vector of strings
+// WHEN: The rows they point to are swapped, assigned and moved from
+// THEN: The elements of all zipped containers should be swapped, assigned and moved together
+TEST_F(ZipIteratorTest, SwapAssignAndMoveRows)
+{
+    std::list<int> list{1, 2};
+    std::vector<std::string> strings{"one", "two"};
+
+    using iterator_type = msd::zip_iterator<std::list<int>::iterator, std::vector<std::string>::iterator>;
+    const iterator_type first{list.begin(), strings.begin()};
+    const iterator_type second = std::next(first);
+
+    iter_swap(first, second);
+    EXPECT_EQ(list, (std::list<int>{2, 1}));
+    EXPECT_EQ(strings, (std::vector<std::string>{"two", "one"}));
+
+    std::swap(list.front(), list.back());
+    swap(*first, *second);
+    EXPECT_EQ(strings, (std::vector<std::string>{"one", "two"}));
+
+    *first = *second;
+    EXPECT_EQ(list, (std::list<int>{1, 1}));
+    EXPECT_EQ(strings, (std::vector<std::string>{"two", "two"}));
+
+    const iterator_type::value_type moved = iter_move(first);
+    EXPECT_EQ(moved, (std::tuple<int, std::string>{1, "two"}));
+    EXPECT_TRUE(strings.front().empty());
+
+    *first = iterator_type::value_type{3, "three"};
+    EXPECT_EQ(list.front(), 3);
+    EXPECT_EQ(strings.front(), "three");
+}
+
+// GIVEN: zip_iterator objects over std::array lookup tables
+// WHEN: They are used in constant expressions
+// THEN: They should be evaluated at compile time
+TEST_F(ZipIteratorTest, ConstantExpressions)
+{
+    static constexpr std::array<int, 3> kFirst{1, 2, 3};
+    static constexpr std::array<int, 2> kSecond{4, 5};
+
+    using iterator_type = msd::zip_iterator<std::array<int, 3>::const_iterator, std::array<int, 2>::const_iterator>;
+    constexpr iterator_type begin{kFirst.begin(), kSecond.begin()};
+    constexpr iterator_type end{kFirst.end(), kSecond.end()};
+
+    static_assert(end - begin == 2);
+    static_assert(std::get<1>(begin[1]) == 5);
+    static_assert(std::next(begin, 2) == end);
+    static_assert(begin < end);
+
+    constexpr auto sum = [begin, end] {
+        int result = 0;
+        for (auto it = begin; it != end; ++it) {
+            result += std::get<0>(*it) * std::get<1>(*it);
+        }
+        return result;
+    }();
+    static_assert(sum == 14);
+    EXPECT_EQ(sum, 14);
+}
+
+// An iterator whose increment may throw.
+class throwing_iterator : public std::vector<int>::iterator {
+   public:
+    using std::vector<int>::iterator::iterator;
+
+    explicit throwing_iterator(const std::vector<int>::iterator& iterator) : std::vector<int>::iterator{iterator} {}
+
+    throwing_iterator& operator++()
+    {
+        std::vector<int>::iterator::operator++();
+        return *this;
+    }
+};
+
+// GIVEN: zip_iterator types over iterators which don't throw and over an iterator which may throw
+// WHEN: Their exception specifications and copyability are verified
+// THEN: The operations should be noexcept only if the operations of the zipped iterators are, and the zip_iterator
+// should be trivially copyable if the zipped iterators are
+TEST_F(ZipIteratorTest, NoexceptAndTriviallyCopyable)
+{
+    using iterator_type = decltype(begin_iterator_);
+    iterator_type iterator = begin_iterator_;
+
+    static_assert(std::is_trivially_copyable_v<iterator_type>);
+    static_assert(std::is_trivially_copyable_v<msd::zip_iterator<int*, const double*>>);
+    static_assert(std::is_nothrow_move_constructible_v<iterator_type>);
+    static_assert(noexcept(*iterator));
+    static_assert(noexcept(++iterator));
+    static_assert(noexcept(iterator++));
+    static_assert(noexcept(--iterator));
+    static_assert(noexcept(iterator += 2));
+    static_assert(noexcept(iterator + 2));
+    static_assert(noexcept(iterator[1]));
+    static_assert(noexcept(iterator == end_iterator_));
+    static_assert(noexcept(iterator < end_iterator_));
+    static_assert(noexcept(end_iterator_ - iterator));
+
+    std::vector<int> vector{1, 2};
+    using throwing_type = msd::zip_iterator<throwing_iterator, std::vector<int>::iterator>;
+    throwing_type throwing{throwing_iterator{vector.begin()}, vector.begin()};
+
+    static_assert(!noexcept(++throwing));
+    static_assert(noexcept(*throwing));
+    static_assert(noexcept(throwing == throwing));
+
+    using list_type = msd::zip_iterator<std::list<int>::iterator, std::vector<int>::iterator>;
+    static_assert(!noexcept(std::declval<list_type&>() + 1));
+
+    ++throwing;
+    EXPECT_EQ(std::get<0>(*throwing), 2);
+
+    std::vector<iterator_type> iterators(2, begin_iterator_);
+    iterators.push_back(end_iterator_);
+    EXPECT_EQ(iterators.back(), end_iterator_);
+}
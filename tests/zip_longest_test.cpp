@@ -0,0 +1,113 @@
+#include "msd/zip_longest.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "msd/zip_enumerate.hpp"
+
+class ZipLongestTest : public testing::Test {
+   protected:
+    std::vector<int> vector_{1, 2, 3, 4};
+    std::list<double> list_{0.5, 1.5};
+    std::array<std::string, 3> array_{"a", "b", "c"};
+};
+
+// GIVEN: Containers of different lengths
+// WHEN: They are zipped with zip_longest
+// THEN: The rows must continue until the longest container, with the fill values past the end of the others
+TEST_F(ZipLongestTest, FillsShorterContainers)
+{
+    const msd::zip_longest zip{std::make_tuple(-1, 0.0, std::string{"-"}), vector_, list_, array_};
+    EXPECT_EQ(zip.size(), 4);
+    EXPECT_FALSE(zip.empty());
+
+    std::vector<std::tuple<int, double, std::string>> rows;
+    for (auto [number, real, text] : zip) {
+        rows.emplace_back(number, real, text);
+    }
+
+    const std::vector<std::tuple<int, double, std::string>> expected{
+        {1, 0.5, "a"}, {2, 1.5, "b"}, {3, 0.0, "c"}, {4, 0.0, "-"}};
+    EXPECT_EQ(rows, expected);
+
+    static_assert(std::is_same_v<decltype(zip.begin())::reference,
+                                 msd::zip_reference<const int&, const double&, const std::string&>>);
+    static_assert(std::is_same_v<decltype(zip.begin())::value_type, std::tuple<int, double, std::string>>);
+}
+
+// GIVEN: Containers zipped with zip_longest
+// WHEN: The rows are read
+// THEN: They must reference the elements of the containers and the fill values of the view, without copies
+TEST_F(ZipLongestTest, ReferencesElementsAndFillValues)
+{
+    const msd::zip_longest zip{std::make_tuple(0, 9.5), vector_, list_};
+
+    auto it = zip.begin();
+    EXPECT_EQ(&std::get<0>(*it), &vector_[0]);
+    EXPECT_EQ(&std::get<1>(*it), &list_.front());
+
+    std::advance(it, 3);
+    EXPECT_EQ(&std::get<0>(*it), &vector_[3]);
+    EXPECT_EQ(&std::get<1>(*it), &std::get<1>(zip.fills()));
+    EXPECT_EQ(std::get<1>(*it), 9.5);
+
+    EXPECT_EQ(std::next(it), zip.end());
+    EXPECT_EQ(std::distance(zip.begin(), zip.end()), 4);
+    EXPECT_EQ(vector_.size(), 4);
+    EXPECT_EQ(list_.size(), 2);
+}
+
+// GIVEN: Empty, forward only and temporary containers
+// WHEN: They are zipped with zip_longest
+// THEN: The size must be the largest size, and temporaries must be owned by the view
+TEST_F(ZipLongestTest, EmptyForwardAndTemporaryContainers)
+{
+    const std::vector<int> empty;
+    const msd::zip_longest empties{std::make_tuple(0, 0), empty, std::vector<int>{}};
+    EXPECT_TRUE(empties.empty());
+    EXPECT_EQ(empties.size(), 0);
+    EXPECT_EQ(empties.begin(), empties.end());
+
+    const std::forward_list<char> letters{'x', 'y', 'z'};
+    const auto make = [&letters] { return msd::zip_longest{std::make_tuple(' ', 7), letters, std::vector<int>{1}}; };
+    const auto zip = make();
+
+    EXPECT_EQ(zip.size(), 3);
+    std::string text;
+    int sum = 0;
+    for (auto [letter, number] : zip) {
+        text += letter;
+        sum += number;
+    }
+    EXPECT_EQ(text, "xyz");
+    EXPECT_EQ(sum, 1 + 7 + 7);
+}
+
+// GIVEN: Containers whose iterators return proxies or values instead of references
+// WHEN: They are zipped with zip_longest
+// THEN: The rows must hold copies of their elements and of the fill values
+TEST_F(ZipLongestTest, ContainersWithoutReferences)
+{
+    std::vector<bool> flags{true, false, true};
+    const msd::zip_longest zip{std::make_tuple(false, std::size_t{9}, 0), flags, msd::iota{2}, vector_};
+
+    static_assert(std::is_same_v<decltype(zip.begin())::reference, msd::zip_reference<bool, std::size_t, const int&>>);
+
+    std::vector<std::tuple<bool, std::size_t, int>> rows;
+    for (auto [flag, index, number] : zip) {
+        rows.emplace_back(flag, index, number);
+    }
+
+    const std::vector<std::tuple<bool, std::size_t, int>> expected{
+        {true, 0, 1}, {false, 1, 2}, {true, 9, 3}, {false, 9, 4}};
+    EXPECT_EQ(rows, expected);
+}
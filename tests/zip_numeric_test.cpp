@@ -0,0 +1,145 @@
+#include "msd/zip_numeric.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "msd/zip.hpp"
+
+class ZipNumericTest : public testing::Test {
+   protected:
+    // Small integers and sums of their products are exactly representable, so any summation order gives the same result.
+    template <typename T>
+    static std::vector<T> sequence(const std::size_t size, const int step)
+    {
+        std::vector<T> values(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            values[i] = static_cast<T>(static_cast<int>(i % 7) * step - 3);
+        }
+        return values;
+    }
+
+    template <typename T>
+    static T naive_dot(const std::vector<T>& lhs, const std::vector<T>& rhs)
+    {
+        T sum{};
+        for (auto [a, b] : msd::zip(lhs, rhs)) {
+            sum += a * b;
+        }
+        return sum;
+    }
+
+    template <typename T>
+    static void expect_all_kernels(const std::size_t size)
+    {
+        const auto lhs = sequence<T>(size, 2);
+        const auto rhs = sequence<T>(size + 3, -1);
+        const auto expected = naive_dot(lhs, rhs);
+
+        EXPECT_EQ(msd::dot(msd::zip(lhs, rhs), T{}), expected) << "size " << size;
+
+        const auto isa = msd::supported_simd_isa();
+        for (auto candidate : {msd::simd_isa::kScalar, msd::simd_isa::kSse2, msd::simd_isa::kAvx2,
+                               msd::simd_isa::kAvx512}) {
+            if (candidate <= isa) {
+                EXPECT_EQ(msd::detail::dot(candidate, lhs.data(), rhs.data(), size), expected) << "size " << size;
+            }
+        }
+    }
+};
+
+// GIVEN: Two contiguous columns of floats or doubles, with sizes that are not multiples of the vector widths
+// WHEN: Their dot product is computed with each supported kernel
+// THEN: The results should be the same as with a range-for loop
+TEST_F(ZipNumericTest, DotProductKernels)
+{
+    for (std::size_t size = 0; size <= 70; ++size) {
+        expect_all_kernels<float>(size);
+        expect_all_kernels<double>(size);
+    }
+    expect_all_kernels<float>(100'003);
+    expect_all_kernels<double>(100'003);
+}
+
+// GIVEN: Columns which are not eligible for the vectorized kernels
+// WHEN: Their dot product is computed
+// THEN: The generic path should give the same result, starting from the initial value
+TEST_F(ZipNumericTest, DotProductGenericPath)
+{
+    const std::vector<int> ints{1, 2, 3, 4};
+    const std::list<int> list{5, 6, 7};
+    EXPECT_EQ(msd::dot(msd::zip(ints, list), 100), 100 + 5 + 12 + 21);
+
+    const std::vector<float> floats{1.5F, 2.0F, 4.0F};
+    const std::array<double, 3> doubles{2.0, 0.5, 0.25};
+    EXPECT_EQ(msd::dot(msd::zip(floats, doubles), 1.0), 1.0 + 3.0 + 1.0 + 1.0);
+
+    const std::vector<double> empty;
+    EXPECT_EQ(msd::dot(msd::zip(empty, doubles), 2.5), 2.5);
+}
+
+// GIVEN: Two contiguous columns of floats
+// WHEN: Their dot product is computed into a double or an int
+// THEN: The products should be accumulated row by row in the type of the result, as by the generic path
+TEST_F(ZipNumericTest, DotProductInTypeOfResult)
+{
+    std::vector<float> lhs(64, 1.0F);
+    lhs[0] = 16'777'216.0F;
+    const std::vector<float> rhs(64, 1.0F);
+
+    const auto generic = [](const auto& zipped, auto init) {
+        return msd::zip_transform_reduce(zipped, init, std::plus<>{}, [](float a, float b) { return a * b; });
+    };
+
+    EXPECT_EQ(msd::dot(msd::zip(lhs, rhs), 0.0), generic(msd::zip(lhs, rhs), 0.0));
+    EXPECT_EQ(msd::dot(msd::zip(lhs, rhs), 0.0), 16'777'216.0 + 63.0);
+
+    const std::vector<float> halves(4, 0.5F);
+    EXPECT_EQ(msd::dot(msd::zip(halves, rhs), 0), generic(msd::zip(halves, rhs), 0));
+    EXPECT_EQ(msd::dot(msd::zip(halves, rhs), 0), 0);
+}
+
+// GIVEN: A zip of multiple columns
+// WHEN: The rows are transformed and reduced
+// THEN: The transformation should receive the elements of each row, and the results should be reduced
+TEST_F(ZipNumericTest, TransformReduce)
+{
+    const std::vector<double> values{1.0, 2.0, 3.0};
+    const std::vector<double> weights{0.5, 0.25, 2.0};
+    const std::vector<int> enabled{1, 0, 1};
+
+    const auto weighted = msd::zip_transform_reduce(
+        msd::zip(values, weights, enabled), 0.0, std::plus<>{},
+        [](const double value, const double weight, const int on) { return on != 0 ? value * weight : 0.0; });
+    EXPECT_EQ(weighted, 0.5 + 6.0);
+
+    const auto maximum = msd::zip_transform_reduce(
+        msd::zip(values, weights), 0.0, [](const double a, const double b) { return a > b ? a : b; },
+        std::multiplies<>{});
+    EXPECT_EQ(maximum, 6.0);
+
+    const auto dot = msd::zip_transform_reduce(msd::zip(values, weights), 1.0, std::plus<>{}, std::multiplies<>{});
+    EXPECT_EQ(dot, 1.0 + 0.5 + 0.5 + 6.0);
+}
+
+// GIVEN: A zip of two containers
+// WHEN: The rows are folded with msd::zip_reduce
+// THEN: The operation should receive the rows in order
+TEST_F(ZipNumericTest, Reduce)
+{
+    const std::vector<int> digits{1, 2, 3};
+    const std::list<char> letters{'a', 'b', 'c'};
+
+    const auto text = msd::zip_reduce(msd::zip(digits, letters), std::string{}, [](std::string acc, auto row) {
+        acc += std::to_string(std::get<0>(row));
+        acc += std::get<1>(row);
+        return acc;
+    });
+    EXPECT_EQ(text, "1a2b3c");
+}
@@ -0,0 +1,257 @@
+#include "msd/zip_parallel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "msd/zip.hpp"
+
+class ZipParallelTest : public testing::Test {
+   protected:
+    static constexpr std::size_t kSize = 10'000;
+
+    std::vector<int> first_ = std::vector<int>(kSize);
+    std::vector<int> second_ = std::vector<int>(kSize + 5);
+
+    void SetUp() override
+    {
+        std::iota(first_.begin(), first_.end(), 0);
+        std::iota(second_.begin(), second_.end(), 0);
+    }
+};
+
+// GIVEN: Random access containers zipped together
+// WHEN: parallel_for is called with the default, a custom and a fine grain
+// THEN: The function must be applied once to each row
+TEST_F(ZipParallelTest, AppliesFunctionToEachRowOnce)
+{
+    for (const std::size_t grain : {0UL, 1UL, 7UL, 100'000UL}) {
+        std::vector<std::atomic<int>> calls(kSize);
+
+        msd::parallel_for(
+            msd::zip(first_, second_, calls),
+            [](auto row) {
+                auto& [a, b, count] = row;
+                a += b;
+                ++count;
+            },
+            msd::parallel_options{4, grain});
+
+        for (std::size_t i = 0; i < kSize; ++i) {
+            EXPECT_EQ(calls[i], 1) << "grain " << grain;
+        }
+        std::iota(first_.begin(), first_.end(), 0);
+    }
+
+    msd::parallel_for(msd::zip(first_, second_), [](auto row) { std::get<0>(row) *= 2; });
+    for (std::size_t i = 0; i < kSize; ++i) {
+        EXPECT_EQ(first_[i], static_cast<int>(i) * 2);
+    }
+}
+
+// GIVEN: Rows with costs varying a hundred times, the first of them holding its thread until another thread processed
+// a row
+// WHEN: parallel_for is called on a pool
+// THEN: The rows must be spread over multiple threads
+TEST_F(ZipParallelTest, BalancesUnevenRows)
+{
+    msd::thread_pool pool{4};
+    EXPECT_EQ(pool.size(), 4);
+
+    std::mutex mutex;
+    std::condition_variable spread;
+    std::set<std::thread::id> threads;
+    std::atomic<long> sum{0};
+
+    msd::parallel_for(pool, msd::zip(first_, second_), [&](auto row) {
+        const auto [a, b] = row;
+        long value = 0;
+        for (int i = 0; i < (a % 100 == 0 ? 100 : 1) * 100; ++i) {
+            value += (a + b + i) % 3;
+        }
+        sum += value;
+
+        std::unique_lock lock{mutex};
+        threads.insert(std::this_thread::get_id());
+        spread.notify_all();
+        if (a == 0) {
+            // Holding the thread leaves the queued rows to the others; the timeout keeps a broken pool from hanging.
+            spread.wait_for(lock, std::chrono::seconds{10}, [&threads] { return threads.size() > 1; });
+        }
+    });
+
+    EXPECT_GT(sum, 0);
+    EXPECT_GT(threads.size(), 1);
+    EXPECT_LE(threads.size(), 5);
+}
+
+// GIVEN: A zip with a bidirectional only container
+// WHEN: parallel_for is called
+// THEN: The rows must be processed sequentially, on the calling thread
+TEST_F(ZipParallelTest, SequentialForBidirectionalContainers)
+{
+    std::list<int> list{1, 2, 3};
+    const auto caller = std::this_thread::get_id();
+
+    msd::parallel_for(msd::zip(first_, list), [&caller](auto row) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        std::get<1>(row) = std::get<0>(row);
+    });
+
+    EXPECT_EQ(list, (std::list<int>{0, 1, 2}));
+}
+
+// GIVEN: A function throwing on some rows
+// WHEN: parallel_for is called
+// THEN: The exception must be rethrown to the caller after all tasks finish
+TEST_F(ZipParallelTest, RethrowsExceptions)
+{
+    msd::thread_pool pool{3};
+
+    EXPECT_THROW(msd::parallel_for(
+                     pool, msd::zip(first_, second_),
+                     [](auto row) {
+                         if (std::get<0>(row) % 1000 == 999) {
+                             throw std::runtime_error{"row"};
+                         }
+                     },
+                     msd::parallel_options{0, 16}),
+                 std::runtime_error);
+
+    std::atomic<int> rows{0};
+    msd::parallel_for(pool, msd::zip(first_, second_), [&rows](auto) { ++rows; });
+    EXPECT_EQ(rows, static_cast<int>(kSize));
+}
+
+// GIVEN: A user-supplied executor
+// WHEN: parallel_for is called with it
+// THEN: The tasks must be submitted to the executor
+TEST_F(ZipParallelTest, UserSuppliedExecutor)
+{
+    class inline_executor {
+       public:
+        std::size_t tasks{0};
+
+        void execute(const std::function<void()>& task)
+        {
+            ++tasks;
+            task();
+        }
+    };
+
+    inline_executor executor;
+    msd::parallel_for(
+        executor, msd::zip(first_, second_), [](auto row) { std::get<0>(row) = 1; }, msd::parallel_options{0, 1000});
+
+    EXPECT_EQ(std::accumulate(first_.begin(), first_.end(), 0), static_cast<int>(kSize));
+    EXPECT_GT(executor.tasks, 1);
+}
+
+// GIVEN: User-supplied executors telling different numbers of threads, and executors telling none
+// WHEN: parallel_for is called with them and the default grain
+// THEN: The rows must be split for the number of threads of the executor, else of the options
+TEST_F(ZipParallelTest, DefaultGrainFromNumberOfThreads)
+{
+    class sized_executor {
+       public:
+        std::size_t threads{0};
+        std::size_t tasks{0};
+
+        [[nodiscard]] std::size_t size() const { return threads; }
+
+        void execute(const std::function<void()>& task)
+        {
+            ++tasks;
+            task();
+        }
+    };
+
+    class unsized_executor {
+       public:
+        std::size_t tasks{0};
+
+        void execute(const std::function<void()>& task)
+        {
+            ++tasks;
+            task();
+        }
+    };
+
+    const auto tasks = [this](auto& executor, const std::size_t threads) {
+        msd::parallel_for(executor, msd::zip(first_, second_), [](auto) {}, msd::parallel_options{threads, 0});
+        return executor.tasks;
+    };
+
+    sized_executor two{2};
+    sized_executor four{4};
+    sized_executor eight_from_options{0};
+    const auto with_two = tasks(two, 8);
+    const auto with_four = tasks(four, 8);
+    EXPECT_LT(with_two, with_four);
+    EXPECT_LT(with_four, tasks(eight_from_options, 8));
+
+    unsized_executor unsized;
+    EXPECT_EQ(tasks(unsized, 2), with_two);
+}
+
+// GIVEN: A user-supplied executor failing to submit every third task
+// WHEN: parallel_for is called with it
+// THEN: The rows of the tasks which can't be submitted must be processed by the submitting tasks, each row once
+TEST_F(ZipParallelTest, ExecutorFailingToSubmitTasks)
+{
+    class failing_executor {
+       public:
+        std::size_t calls{0};
+
+        void execute(const std::function<void()>& task)
+        {
+            if (++calls % 3 == 0) {
+                throw std::runtime_error{"execute"};
+            }
+            task();
+        }
+    };
+
+    std::vector<std::atomic<int>> calls(kSize);
+    failing_executor executor;
+    msd::parallel_for(
+        executor, msd::zip(first_, calls), [](auto row) { ++std::get<1>(row); }, msd::parallel_options{0, 100});
+
+    EXPECT_GT(executor.calls, 3);
+    for (std::size_t i = 0; i < kSize; ++i) {
+        EXPECT_EQ(calls[i], 1);
+    }
+}
+
+// GIVEN: A parallel_for running on a pool
+// WHEN: Each task calls parallel_for on the same pool
+// THEN: The nested calls must complete without deadlocking
+TEST_F(ZipParallelTest, NestedCalls)
+{
+    msd::thread_pool pool{2};
+    std::vector<int> outer(8);
+    std::vector<int> indices(8);
+    std::atomic<int> rows{0};
+
+    msd::parallel_for(
+        pool, msd::zip(outer, indices),
+        [&](auto) {
+            msd::parallel_for(
+                pool, msd::zip(first_, second_), [&rows](auto) { ++rows; }, msd::parallel_options{0, 100});
+        },
+        msd::parallel_options{0, 1});
+
+    EXPECT_EQ(rows, static_cast<int>(kSize * outer.size()));
+}
@@ -0,0 +1,80 @@
+#include "msd/zip_prefetch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <map>
+#include <set>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "msd/zip.hpp"
+
+class ZipPrefetchTest : public testing::Test {
+   protected:
+    std::list<int> list_{1, 2, 3, 4, 5, 6};
+    std::map<int, char> map_{{1, 'a'}, {2, 'b'}, {3, 'c'}, {4, 'd'}};
+    const std::set<int> set_{10, 20, 30, 40, 50};
+};
+
+// GIVEN: Node based containers of different lengths
+// WHEN: They are zipped with prefetching_zip with various lookahead distances
+// THEN: The rows must be the same as with msd::zip, stopping at the shortest container
+TEST_F(ZipPrefetchTest, SameRowsAsZip)
+{
+    std::vector<std::tuple<int, char, int>> expected;
+    for (auto [number, pair, element] : msd::zip(list_, map_, set_)) {
+        expected.emplace_back(number, pair.second, element);
+    }
+
+    for (const std::size_t distance : {0UL, 1UL, 3UL, 4UL, 100UL}) {
+        const msd::prefetching_zip zip(distance, list_, map_, set_);
+        EXPECT_EQ(zip.distance(), distance);
+        EXPECT_EQ(zip.size(), 4);
+
+        std::vector<std::tuple<int, char, int>> rows;
+        for (auto [number, pair, element] : zip) {
+            rows.emplace_back(number, pair.second, element);
+        }
+        EXPECT_EQ(rows, expected) << "distance " << distance;
+        EXPECT_EQ(std::distance(zip.begin(), zip.end()), 4);
+    }
+
+    static_assert(std::is_same_v<msd::prefetching_zip<std::list<int>, std::vector<int>>::iterator::iterator_category,
+                                 std::forward_iterator_tag>);
+}
+
+// GIVEN: Containers zipped with prefetching_zip
+// WHEN: The rows are modified
+// THEN: The containers must be modified
+TEST_F(ZipPrefetchTest, ModifiesContainers)
+{
+    std::vector<int> vector(6);
+    for (auto [number, value] : msd::prefetching_zip(2, list_, vector)) {
+        value = number * 2;
+    }
+    EXPECT_EQ(vector, (std::vector<int>{2, 4, 6, 8, 10, 12}));
+}
+
+// GIVEN: Empty and temporary containers
+// WHEN: They are zipped with prefetching_zip
+// THEN: The view must be empty if any container is empty, and temporaries must be owned
+TEST_F(ZipPrefetchTest, EmptyAndTemporaryContainers)
+{
+    const std::list<int> empty;
+    const msd::prefetching_zip empty_zip(8, empty, list_);
+    EXPECT_TRUE(empty_zip.empty());
+    EXPECT_EQ(empty_zip.begin(), empty_zip.end());
+
+    const auto make = [this] { return msd::prefetching_zip(8, std::list<int>{7, 8}, list_); };
+    const auto zip = make();
+
+    int sum = 0;
+    for (auto [a, b] : zip) {
+        sum += a * b;
+    }
+    EXPECT_EQ(sum, 7 * 1 + 8 * 2);
+}
@@ -0,0 +1,123 @@
+#include "msd/zip_stream.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "msd/zip.hpp"
+
+/**
+ * @brief A generator-style input iterator producing the numbers below a limit, counting how many were produced.
+ */
+class counter_iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = int;
+    using pointer = const int*;
+    using reference = const int&;
+
+    counter_iterator() = default;
+    counter_iterator(const int limit, int* produced) : limit_{limit}, produced_{produced} { ++*produced_; }
+
+    reference operator*() const { return value_; }
+
+    counter_iterator& operator++()
+    {
+        ++value_;
+        if (value_ < limit_) {
+            ++*produced_;
+        }
+        return *this;
+    }
+
+    counter_iterator operator++(int)
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    bool operator==(const counter_iterator& other) const { return done() == other.done(); }
+    bool operator!=(const counter_iterator& other) const { return !(*this == other); }
+
+   private:
+    int value_{0};
+    int limit_{0};
+    int* produced_{nullptr};
+
+    [[nodiscard]] bool done() const { return value_ >= limit_; }
+};
+
+class ZipStreamTest : public testing::Test {
+   protected:
+    std::istringstream numbers_{"1 2 3 4 5"};
+    std::istringstream words_{"one two three"};
+};
+
+// GIVEN: Input streams of different lengths
+// WHEN: They are zipped with streaming_zip
+// THEN: The records must be read once, in lockstep, until a stream is exhausted
+TEST_F(ZipStreamTest, ZipsInputStreams)
+{
+    msd::streaming_zip zip(msd::iterator_range(std::istream_iterator<int>{numbers_}, {}),
+                           msd::iterator_range(std::istream_iterator<std::string>{words_}, {}));
+    static_assert(std::is_same_v<decltype(zip)::iterator::iterator_category, std::input_iterator_tag>);
+
+    std::vector<std::tuple<int, std::string>> rows;
+    for (auto [number, word] : zip) {
+        rows.emplace_back(number, word);
+    }
+
+    const std::vector<std::tuple<int, std::string>> expected{{1, "one"}, {2, "two"}, {3, "three"}};
+    EXPECT_EQ(rows, expected);
+
+    // The number stream is positioned after the 4th record, read when the word stream was found exhausted.
+    int next = 0;
+    numbers_ >> next;
+    EXPECT_EQ(next, 5);
+}
+
+// GIVEN: A generator-style input range and a forward list
+// WHEN: They are zipped with streaming_zip
+// THEN: No range is traversed to compute sizes, so each element is produced once
+TEST_F(ZipStreamTest, TraversesRangesOnce)
+{
+    int produced = 0;
+    const std::forward_list<char> letters{'a', 'b', 'c', 'd'};
+
+    const msd::streaming_zip zip(msd::iterator_range(counter_iterator{100, &produced}, counter_iterator{}), letters);
+    EXPECT_EQ(produced, 1);
+
+    std::string text;
+    for (auto [number, letter] : zip) {
+        text += std::to_string(number);
+        text += letter;
+    }
+
+    EXPECT_EQ(text, "0a1b2c3d");
+    EXPECT_EQ(produced, 5);
+}
+
+// GIVEN: Forward ranges, one of them temporary
+// WHEN: They are zipped with streaming_zip
+// THEN: The rows can be modified and the temporary must be owned
+TEST_F(ZipStreamTest, ForwardRanges)
+{
+    std::forward_list<int> values{1, 2, 3};
+    msd::streaming_zip zip(values, std::vector<int>{10, 20});
+    static_assert(std::is_same_v<decltype(zip)::iterator::iterator_category, std::forward_iterator_tag>);
+
+    for (auto [value, factor] : zip) {
+        value *= factor;
+    }
+    EXPECT_EQ(values, (std::forward_list<int>{10, 40, 3}));
+    EXPECT_EQ(std::distance(zip.begin(), zip.end()), 2);
+}
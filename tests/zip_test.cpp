@@ -2,14 +2,33 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <forward_list>
 #include <iterator>
+#include <list>
+#include <set>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "data.hpp"
+#include "msd/zip_enumerate.hpp"
+
+class sized_list : public std::list<int> {
+   public:
+    using std::list<int>::list;
+
+    mutable std::size_t size_calls_ = 0;
+
+    [[nodiscard]] std::size_t size() const
+    {
+        ++size_calls_;
+        return std::list<int>::size();
+    }
+};
 
 class ZipTest : public testing::Test {
    protected:
@@ -65,6 +84,57 @@ TEST_F(ZipTest, End)
     EXPECT_EQ(zip_.end() - 2, zip_.begin());
 }
 
+// GIVEN: A zip object is created with non random access containers of different sizes
+// WHEN: The end() method is called
+// THEN: The end should be reached after iterating over the elements of the smallest container
+TEST_F(ZipTest, EndOfNonRandomAccessContainers)
+{
+    std::list<int> list{1, 2, 3};
+    const std::forward_list<int> forward_list{4, 5};
+    std::vector<int> vector{6, 7, 8, 9};
+    msd::zip zip(list, forward_list, vector);
+
+    EXPECT_EQ(std::next(zip.begin(), 2), zip.end());
+    EXPECT_EQ(std::next(zip.cbegin(), 2), zip.cend());
+    EXPECT_EQ(std::distance(zip.begin(), zip.end()), 2);
+
+    std::vector<int> sums;
+    for (auto [a, b, c] : zip) {
+        sums.push_back(a + b + c);
+    }
+    EXPECT_EQ(sums, (std::vector<int>{11, 14}));
+
+    auto [a, b, c] = zip.back();
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 5);
+    EXPECT_EQ(c, 7);
+}
+
+// GIVEN: A zip object is created with bidirectional containers of different sizes
+// WHEN: The end is moved back and the zipped sequence is reversed
+// THEN: The end must be aligned on the last row, and only the zipped rows must be reversed
+TEST_F(ZipTest, EndOfBidirectionalContainersOfDifferentSizes)
+{
+    std::list<int> first{1, 2, 3};
+    std::list<int> second{4, 5};
+    std::list<int> third{6, 7, 8, 9, 10, 11};
+    msd::zip zip(first, second, third);
+
+    static_assert(std::is_same_v<decltype(zip.begin())::iterator_category, std::bidirectional_iterator_tag>);
+    EXPECT_EQ(std::distance(zip.begin(), zip.end()), 2);
+
+    auto [a, b, c] = *std::prev(zip.end());
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 5);
+    EXPECT_EQ(c, 7);
+    EXPECT_EQ(std::prev(zip.cend(), 2), zip.cbegin());
+
+    std::reverse(zip.begin(), zip.end());
+    EXPECT_EQ(first, (std::list<int>{2, 1, 3}));
+    EXPECT_EQ(second, (std::list<int>{5, 4}));
+    EXPECT_EQ(third, (std::list<int>{7, 6, 8, 9, 10, 11}));
+}
+
 // GIVEN: A zip object is created with three containers of different sizes
 // WHEN: The cbegin() method is called and elements are accessed
 // THEN: The first elements of each container should be returned correctly in a const context, and the iterator
@@ -112,6 +182,22 @@ TEST_F(ZipTest, Size)
     EXPECT_EQ(const_zip_.size(), 2);
 }
 
+// GIVEN: A zip object is created with a container providing its size and a container without size
+// WHEN: The size() method is called
+// THEN: The size of the container should be used if provided, and the container without size should be traversed
+TEST_F(ZipTest, SizeUsesTheSizeOfTheContainers)
+{
+    sized_list list{1, 2, 3};
+    const std::forward_list<int> forward_list{4, 5, 6, 7};
+
+    const msd::zip zip(list, forward_list);
+    EXPECT_EQ(zip.size(), 3);
+    EXPECT_EQ(list.size_calls_, 1);
+
+    EXPECT_FALSE(zip.empty());
+    EXPECT_EQ(list.size_calls_, 1);
+}
+
 // GIVEN: A zip object is created with one non-empty container and one empty container
 // WHEN: The size() method is called
 // THEN: The size should be zero as one of the containers is empty
@@ -345,3 +431,169 @@ TEST_F(ZipTest, CopyAndMoveZip)
         EXPECT_EQ(actual_c, expected_c);
     }
 }
+
+// GIVEN: An rvalue container and an lvalue container
+// WHEN: They are zipped together
+// THEN: The rvalue container should be moved into the zip and the lvalue container should be referenced
+TEST_F(ZipTest, RvalueContainersAreOwned)
+{
+    std::vector<data> items;
+    items.reserve(2);
+    items.emplace_back(1);
+    items.emplace_back(2);
+    const auto copies = data::copies_;
+    const auto moves = data::moves_;
+
+    msd::zip zip(std::move(items), vector_two_);
+    static_assert(std::is_same_v<decltype(zip), msd::zip<std::vector<data>&&, std::vector<int>>>);
+    EXPECT_EQ(data::copies_, copies);
+    EXPECT_EQ(data::moves_, moves);
+
+    for (auto [a, b] : zip) {
+        b = a.num * 10;
+    }
+    EXPECT_EQ(vector_two_, (std::vector<int>{10, 20}));
+
+    auto [a, b] = zip.front();
+    a.num = 3;
+    EXPECT_EQ(std::get<0>(zip.front()).num, 3);
+    EXPECT_EQ(zip.size(), 2);
+}
+
+// GIVEN: Containers returned by a function
+// WHEN: They are zipped together and the zip is returned by a function
+// THEN: The zip should own the containers and they should not dangle
+TEST_F(ZipTest, ZipOfTemporaries)
+{
+    const auto make_vector = [](const int value) { return std::vector<int>(3, value); };
+    const auto make_zip = [&make_vector]() { return msd::zip(make_vector(1), make_vector(2), std::list<int>{3, 4}); };
+
+    const auto zip = make_zip();
+    static_assert(
+        std::is_same_v<decltype(zip), const msd::zip<std::vector<int>&&, std::vector<int>&&, std::list<int>&&>>);
+
+    int sum = 0;
+    for (auto [a, b, c] : zip) {
+        sum += a + b + c;
+    }
+    EXPECT_EQ(sum, 13);
+
+    const auto copy = zip;
+    std::get<0>(copy.front()) = 5;
+    EXPECT_EQ(std::get<0>(zip.front()), 1);
+}
+
+// GIVEN: std::array and C array lookup tables
+// WHEN: They are zipped together in constant expressions
+// THEN: The zip should be evaluated at compile time, with a size known at compile time
+TEST_F(ZipTest, ConstantExpressions)
+{
+    static constexpr std::array<int, 4> kKeys{1, 2, 3, 4};
+    static constexpr int kWeights[] = {10, 20, 30};
+
+    constexpr msd::zip zip(kKeys, kWeights);
+    static_assert(decltype(zip)::kExtent == 3);
+    static_assert(zip.size() == 3);
+    static_assert(!zip.empty());
+    static_assert(std::get<1>(zip.back()) == 30);
+    static_assert(std::get<0>(zip[1]) == 2);
+
+    constexpr auto products = [] {
+        constexpr msd::zip table(kKeys, kWeights);
+        std::array<int, table.size()> result{};
+
+        for (auto [key, weight, product] : msd::zip(kKeys, kWeights, result)) {
+            product = key * weight;
+        }
+        return result;
+    }();
+    static_assert(products[0] == 10 && products[1] == 40 && products[2] == 90);
+
+    constexpr auto dot = [] {
+        int sum = 0;
+        const msd::zip table(kKeys, kWeights);
+        for (auto it = table.begin(); it != table.end(); ++it) {
+            sum += std::get<0>(*it) * std::get<1>(*it);
+        }
+        return sum;
+    }();
+    static_assert(dot == 140);
+
+    static_assert(msd::zip<std::vector<int>, std::array<int, 2>>::kExtent == msd::kDynamicExtent);
+    EXPECT_EQ(zip.size(), 3);
+}
+
+// GIVEN: Node based containers of different sizes, the shortest one not being the first
+// WHEN: They are zipped together and iterated, then the shortest container grows
+// THEN: The iteration should stop at the end of the shortest container each time
+TEST_F(ZipTest, IterationStopsAtTheShortestNodeBasedContainer)
+{
+    std::list<int> long_list{1, 2, 3, 4};
+    std::list<int> short_list{5, 6};
+    std::set<int> set{7, 8, 9};
+    const msd::zip zip(long_list, short_list, set);
+
+    int rows = 0;
+    for (auto it = zip.begin(); it != zip.end(); ++it) {
+        ++rows;
+    }
+    EXPECT_EQ(rows, 2);
+    EXPECT_EQ(std::distance(zip.begin(), zip.end()), 2);
+
+    short_list.push_back(10);
+    short_list.push_back(11);
+    EXPECT_EQ(std::distance(zip.begin(), zip.end()), 3);
+
+    using iterator_type = decltype(zip)::iterator;
+    const iterator_type begin{long_list.begin(), short_list.begin(), set.begin()};
+    const iterator_type end{long_list.end(), short_list.end(), set.end()};
+    EXPECT_EQ(std::distance(begin, end), 3);
+}
+
+// GIVEN: Zips of more than 2^32 rows of counting iterators, which don't allocate the rows
+// WHEN: Rows past 2^31 and 2^32 are accessed by offset, from the end and by chunks
+// THEN: The offsets must not be truncated, with a single offset and with an iterator for each sequence
+TEST_F(ZipTest, OffsetsBeyond32Bits)
+{
+    constexpr std::size_t kRows = (std::size_t{1} << 32) + 7;
+    constexpr std::size_t kPast31Bits = (std::size_t{1} << 31) + 3;
+    static_assert(sizeof(std::ptrdiff_t) == sizeof(std::int64_t), "64-bit offsets are tested on 64-bit targets");
+
+    const msd::iota rows{0, kRows};
+    const msd::iota shifted{5, kRows + 10};
+    const msd::iterator_range<msd::iota::iterator> counted{rows.begin(), rows.end()};
+
+    const auto check = [kRows, kPast31Bits](const auto& zip) {
+        EXPECT_EQ(zip.size(), kRows);
+        EXPECT_EQ(std::get<0>(zip[kPast31Bits]), kPast31Bits);
+        EXPECT_EQ(std::get<1>(zip[kRows - 1]), kRows + 4);
+        EXPECT_EQ(std::get<0>(zip.back()), kRows - 1);
+
+        EXPECT_EQ(zip.end() - zip.begin(), static_cast<std::ptrdiff_t>(kRows));
+        EXPECT_EQ(std::get<0>(*std::prev(zip.end(), static_cast<std::ptrdiff_t>(kPast31Bits))), kRows - kPast31Bits);
+
+        auto it = zip.begin();
+        it += static_cast<std::ptrdiff_t>(kPast31Bits);
+        EXPECT_EQ(std::get<1>(it[static_cast<std::ptrdiff_t>(kPast31Bits)]), 2 * kPast31Bits + 5);
+        EXPECT_LT(it, zip.end());
+
+        std::size_t chunks = 0;
+        std::size_t last_size = 0;
+        for (auto chunk : zip.chunks(kPast31Bits)) {
+            ++chunks;
+            last_size = chunk.size();
+        }
+        EXPECT_EQ(chunks, 3);
+        EXPECT_EQ(last_size, kRows - 2 * kPast31Bits);
+    };
+
+    const msd::zip offsets(rows, shifted);
+    static_assert(std::is_same_v<decltype(offsets)::iterator,
+                                 msd::offset_zip_iterator<msd::iota::iterator, msd::iota::iterator>>);
+    check(offsets);
+
+    const msd::zip iterators(counted, shifted);
+    static_assert(std::is_same_v<decltype(iterators)::iterator,
+                                 msd::zip_iterator<msd::iota::iterator, msd::iota::iterator>>);
+    check(iterators);
+}
@@ -0,0 +1,32 @@
+// Compiled with a vectorization report by the zip_test_vectorization_* tests (see CMakeLists.txt).
+// Each kernel is selected by a macro so the report of each loop is checked separately.
+
+#include <cstdint>
+#include <vector>
+
+#include "msd/zip.hpp"
+
+#if defined(ZIP_VECTORIZE_SUM)
+void sum(std::vector<float>& out, const std::vector<float>& a, const std::vector<float>& b)
+{
+    for (auto [o, x, y] : msd::zip(out, a, b)) {
+        o = x + y;
+    }
+}
+#elif defined(ZIP_VECTORIZE_FMA)
+void fma(std::vector<float>& out, const std::vector<float>& a, const std::vector<float>& b)
+{
+    for (auto [o, x, y] : msd::zip(out, a, b)) {
+        o += x * y;
+    }
+}
+#elif defined(ZIP_VECTORIZE_DOT)
+std::int32_t dot(const std::vector<std::int32_t>& a, const std::vector<std::int32_t>& b)
+{
+    std::int32_t result = 0;
+    for (auto [x, y] : msd::zip(a, b)) {
+        result += x * y;
+    }
+    return result;
+}
+#endif
@@ -0,0 +1,133 @@
+#include "msd/zip_views.hpp"
+
+#include <gtest/gtest.h>
+
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "msd/zip.hpp"
+
+class ZipViewsTest : public testing::Test {
+   protected:
+    std::vector<int> vector_{1, 2, 3, 4, 5, 6};
+    std::list<int> list_{10, 20, 30, 40, 50};
+
+    static int sum(const std::tuple<int&, int&>& row) { return std::get<0>(row) + std::get<1>(row); }
+
+    template <typename View>
+    static std::vector<int> to_vector(const View& view)
+    {
+        std::vector<int> values;
+        for (auto&& value : view) {
+            values.push_back(value);
+        }
+        return values;
+    }
+};
+
+// GIVEN: A zip of two containers
+// WHEN: A function is applied to each row with msd::transform
+// THEN: The results should be computed lazily, once per row
+TEST_F(ZipViewsTest, Transform)
+{
+    int calls = 0;
+    const auto view = msd::zip(vector_, list_) | msd::transform([&calls](auto row) {
+                          ++calls;
+                          return sum(row);
+                      });
+    EXPECT_EQ(calls, 0);
+
+    EXPECT_EQ(view.size(), 5);
+    EXPECT_EQ(to_vector(view), (std::vector<int>{11, 22, 33, 44, 55}));
+    EXPECT_EQ(calls, 5);
+
+    static_assert(std::is_same_v<decltype(view.begin())::value_type, int>);
+    static_assert(std::is_same_v<decltype(view.begin())::iterator_category, std::forward_iterator_tag>);
+}
+
+// GIVEN: A zip of two containers
+// WHEN: The rows are filtered with msd::filter
+// THEN: Only the rows satisfying the predicate should be iterated, and they should reference the containers
+TEST_F(ZipViewsTest, Filter)
+{
+    msd::zip zip(vector_, list_);
+    auto view = zip | msd::filter([](auto row) { return std::get<0>(row) % 2 == 0; });
+
+    for (auto [a, b] : view) {
+        a = b;
+    }
+    EXPECT_EQ(vector_, (std::vector<int>{1, 20, 3, 40, 5, 6}));
+
+    EXPECT_EQ(std::distance(view.begin(), view.end()), 2);
+    EXPECT_FALSE(view.empty());
+    EXPECT_TRUE((zip | msd::filter([](auto) { return false; })).empty());
+}
+
+// GIVEN: A zip of two containers
+// WHEN: The first rows are taken with msd::take and dropped with msd::drop
+// THEN: The views should stop at the given count or at the end of the zip, whichever comes first
+TEST_F(ZipViewsTest, TakeAndDrop)
+{
+    const msd::zip zip(vector_, list_);
+
+    const auto first = zip | msd::take(2);
+    EXPECT_EQ(first.size(), 2);
+    EXPECT_EQ(std::distance(first.begin(), first.end()), 2);
+    EXPECT_EQ(std::get<1>(*first.begin()), 10);
+
+    const auto all = zip | msd::take(100);
+    EXPECT_EQ(all.size(), 5);
+    EXPECT_EQ(std::distance(all.begin(), all.end()), 5);
+    EXPECT_TRUE((zip | msd::take(0)).empty());
+
+    const auto rest = zip | msd::drop(3);
+    EXPECT_EQ(rest.size(), 2);
+    EXPECT_EQ(std::distance(rest.begin(), rest.end()), 2);
+    EXPECT_EQ(std::get<1>(*rest.begin()), 40);
+
+    EXPECT_TRUE((zip | msd::drop(10)).empty());
+    EXPECT_EQ((zip | msd::drop(10)).size(), 0);
+
+    const std::forward_list<int> forward_list{1, 2, 3};
+    EXPECT_EQ(std::distance((forward_list | msd::drop(1)).begin(), (forward_list | msd::drop(1)).end()), 2);
+}
+
+// GIVEN: A zip of two containers
+// WHEN: Multiple adaptors are chained
+// THEN: All adaptors should be applied in a single pass, without intermediate containers
+TEST_F(ZipViewsTest, Composition)
+{
+    int transforms = 0;
+    const auto view = msd::zip(vector_, list_) | msd::drop(1) | msd::transform([&transforms](auto row) {
+                          ++transforms;
+                          return sum(row);
+                      }) |
+                      msd::filter([](const int value) { return value % 2 == 0; }) | msd::take(2);
+
+    EXPECT_EQ(to_vector(view), (std::vector<int>{22, 44}));
+
+    // Rows 22, 33, 44 and 55 are tested by the filter, and the kept rows are transformed again when dereferenced.
+    EXPECT_EQ(transforms, 6);
+
+    const auto total = std::accumulate(view.begin(), view.end(), 0);
+    EXPECT_EQ(total, 66);
+}
+
+// GIVEN: Containers returned by a function
+// WHEN: They are zipped and adapted without being stored
+// THEN: The views should own the temporaries, so they don't dangle
+TEST_F(ZipViewsTest, TemporariesAreOwned)
+{
+    const auto make_view = [] {
+        return msd::zip(std::vector<int>{1, 2, 3}, std::list<int>{4, 5, 6}) |
+               msd::transform([](auto row) { return std::get<0>(row) * std::get<1>(row); });
+    };
+
+    const auto view = make_view();
+    EXPECT_EQ(to_vector(view), (std::vector<int>{4, 10, 18}));
+}